@@ -0,0 +1,1023 @@
+/**
+ * Benchmarks del intérprete de L-systems (Google Benchmark).
+ *
+ * Cada etapa por separado (tokenizado, get_argument, read_desc, matrices de
+ * giro, mat_by_mat, mat_by_vec, assign_GL_mat) sobre todos los archivos de
+ * data/ y sobre entradas sintéticas grandes, en símbolos/s o segmentos/s.
+ *
+ * Para compilar: make bench
+ * Para ejecutar: ./bench   (desde el directorio proyecto/)
+ */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/stat.h>
+#include <benchmark/benchmark.h>
+#include "lsystem.h"
+#include "rewrite.h"
+#include "presets.h"
+#include "parallel.h"
+#include "loader.h"
+#include "lsb.h"
+#include "export.h"
+#include "bvh.h"
+#include "memo.h"
+#include "subtree.h"
+
+/* Entradas ordenadas de menor a mayor tamaño */
+static const char *DATA_FILES[] = {
+    "data/0.txt", "data/2.txt", "data/9.txt", "data/6.txt", "data/8.txt",
+    "data/1.txt", "data/7.txt", "data/3.txt", "data/5.txt", "data/4.txt",
+    "data/dol_a.txt", "data/dol_g.txt"
+};
+static const int NUM_DATA_FILES = sizeof(DATA_FILES) / sizeof(DATA_FILES[0]);
+
+/*
+ * Después de los archivos, entradas sintéticas grandes: la descripción de
+ * dol_a.txt repetida hasta tantos MB, armada en memoria.
+ */
+static const int SYNTHETIC_MB[] = {4, 16};
+static const int NUM_INPUTS = NUM_DATA_FILES + sizeof(SYNTHETIC_MB) / sizeof(SYNTHETIC_MB[0]);
+
+/* Carga la entrada range(0) y fija el paso y ángulo del intérprete */
+static bool load_input(benchmark::State &state, LSystemInterpreter &tortuga, std::string *desc) {
+    int k = state.range(0);
+    const char *path = k < NUM_DATA_FILES ? DATA_FILES[k] : "data/dol_a.txt";
+
+    if (!load_desc_file(path, &tortuga.lstep, &tortuga.langle, desc)) {
+        state.SkipWithError("no se pudo leer el archivo (ejecutar desde proyecto/)");
+        return false;
+    }
+    if (k < NUM_DATA_FILES) {
+        state.SetLabel(path);
+        return true;
+    }
+
+    size_t target = (size_t)SYNTHETIC_MB[k - NUM_DATA_FILES] << 20;
+    std::string one = *desc;
+    desc->reserve(target + one.size());
+    while (desc->size() < target)
+        desc->append(one);
+    state.SetLabel("sintético " + std::to_string(SYNTHETIC_MB[k - NUM_DATA_FILES]) + " MB");
+    return true;
+}
+
+/* Tokenizar la descripción completa */
+static void BM_tokenize(benchmark::State &state) {
+    LSystemInterpreter tortuga;
+    std::string desc;
+    if (!load_input(state, tortuga, &desc)) return;
+
+    for (auto _ : state) {
+        std::vector<Token> cmds = tokenize(desc);
+        benchmark::DoNotOptimize(cmds.data());
+    }
+    state.SetComplexityN(desc.size());
+    state.counters["symbols/s"] = benchmark::Counter(
+        (double)desc.size() * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_tokenize)->DenseRange(0, NUM_INPUTS - 1)->Complexity(benchmark::oN);
+
+/* Solo la lectura de argumentos: get_argument en cada símbolo, sin opcode */
+static void BM_get_argument(benchmark::State &state) {
+    LSystemInterpreter tortuga;
+    std::string desc;
+    size_t symbols = 0;
+    if (!load_input(state, tortuga, &desc)) return;
+
+    for (auto _ : state) {
+        double arg, sum = 0;
+        int jump;
+        symbols = 0;
+        for (size_t i = 0; i < desc.size(); i += jump + 1) {
+            get_argument(desc.data(), desc.size(), i, &arg, &jump);
+            if (jump) sum += arg;
+            symbols++;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.counters["symbols/s"] = benchmark::Counter(
+        (double)symbols * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_get_argument)->DenseRange(0, NUM_INPUTS - 1);
+
+/* Tokenizar e interpretar, tal como lo hace el menú */
+static void BM_read_desc(benchmark::State &state) {
+    LSystemInterpreter tortuga;
+    std::string desc;
+    double P[DIM] = {0.0, 2.0, 0.0};
+    if (!load_input(state, tortuga, &desc)) return;
+
+    for (auto _ : state) {
+        tortuga.lines.clear();
+        tortuga.read_desc(desc, P);
+        benchmark::DoNotOptimize(tortuga.lines.pos.data());
+    }
+    /* El costo de interpretar es proporcional a la cantidad de comandos */
+    state.SetComplexityN(tokenize(desc).size());
+    state.counters["symbols/s"] = benchmark::Counter(
+        (double)desc.size() * state.iterations(), benchmark::Counter::kIsRate);
+    state.counters["segments/s"] = benchmark::Counter(
+        (double)tortuga.lines.size() * state.iterations(), benchmark::Counter::kIsRate);
+    state.counters["bytes/segment"] = (double)tortuga.lines.bytes() / tortuga.lines.size();
+}
+BENCHMARK(BM_read_desc)->DenseRange(0, NUM_INPUTS - 1)->Complexity(benchmark::oN);
+
+/*
+ * Solo los giros de cada archivo, con el ángulo ya resuelto y con signo.
+ * BM_rotate_matrix arma la matriz de rotación y multiplica (el camino
+ * anterior); BM_rotate_kernel usa rotate_U/L/H.
+ */
+typedef struct {
+    unsigned char axis;     /* 0: U, 1: L, 2: H */
+    double angle;
+} Turn;
+
+static bool load_turns(benchmark::State &state, std::vector<Turn> *turns) {
+    LSystemInterpreter tortuga;
+    std::string desc;
+    if (!load_input(state, tortuga, &desc)) return false;
+
+    for (const Token &cmd : tokenize(desc)) {
+        if (cmd.op < OP_TURN_LEFT || cmd.op > OP_ROLL_RIGHT) continue;
+        double arg = cmd.has_arg ? cmd.arg : tortuga.langle;
+        /* Los comandos impares (+ & /) giran con el ángulo negado */
+        Turn t = {(unsigned char)((cmd.op - OP_TURN_LEFT) / 2),
+                  (cmd.op - OP_TURN_LEFT) % 2 ? arg : -arg};
+        turns->push_back(t);
+    }
+    return true;
+}
+
+static void BM_rotate_matrix(benchmark::State &state) {
+    void (*R_matrix[])(double R[DIM][DIM], double angle) = {Rz_matrix, Ry_matrix, Rx_matrix};
+    std::vector<Turn> turns;
+    State S;
+    double P[DIM] = {0.0, 2.0, 0.0};
+    if (!load_turns(state, &turns)) return;
+
+    initial_state(S, P);
+    for (auto _ : state) {
+        for (const Turn &t : turns) {
+            double R[DIM][DIM], M[DIM][DIM];
+            R_matrix[t.axis](R, t.angle);
+            mat_by_mat(M, S.T, R);
+            assign_mat(S.T, M);
+        }
+        benchmark::DoNotOptimize(S.T);
+    }
+    state.counters["rotations/s"] = benchmark::Counter(
+        (double)turns.size() * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_rotate_matrix)->DenseRange(0, NUM_INPUTS - 1);
+
+static void BM_rotate_kernel(benchmark::State &state) {
+    void (*rotate[])(double T[DIM][DIM], double angle) = {rotate_U, rotate_L, rotate_H};
+    std::vector<Turn> turns;
+    State S;
+    double P[DIM] = {0.0, 2.0, 0.0};
+    if (!load_turns(state, &turns)) return;
+
+    initial_state(S, P);
+    for (auto _ : state) {
+        for (const Turn &t : turns)
+            rotate[t.axis](S.T, t.angle);
+        benchmark::DoNotOptimize(S.T);
+    }
+    state.counters["rotations/s"] = benchmark::Counter(
+        (double)turns.size() * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_rotate_kernel)->DenseRange(0, NUM_INPUTS - 1);
+
+/* Solo armar las matrices de giro (Rz, Ry, Rx) de cada archivo */
+static void BM_R_matrix(benchmark::State &state) {
+    void (*R_matrix[])(double R[DIM][DIM], double angle) = {Rz_matrix, Ry_matrix, Rx_matrix};
+    std::vector<Turn> turns;
+    if (!load_turns(state, &turns)) return;
+
+    for (auto _ : state) {
+        double R[DIM][DIM], sum = 0;
+        for (const Turn &t : turns) {
+            R_matrix[t.axis](R, t.angle);
+            sum += R[0][0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.counters["rotations/s"] = benchmark::Counter(
+        (double)turns.size() * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_R_matrix)->DenseRange(0, NUM_INPUTS - 1);
+
+/* Solo mat_by_mat, con las matrices de giro ya armadas */
+static void BM_mat_by_mat(benchmark::State &state) {
+    void (*R_matrix[])(double R[DIM][DIM], double angle) = {Rz_matrix, Ry_matrix, Rx_matrix};
+    std::vector<Turn> turns;
+    std::vector<std::array<double, DIM * DIM>> mats;
+    State S;
+    double P[DIM] = {0.0, 2.0, 0.0};
+    if (!load_turns(state, &turns)) return;
+
+    for (const Turn &t : turns) {
+        double R[DIM][DIM];
+        R_matrix[t.axis](R, t.angle);
+        mats.emplace_back();
+        std::copy(&R[0][0], &R[0][0] + DIM * DIM, mats.back().begin());
+    }
+    initial_state(S, P);
+    for (auto _ : state) {
+        for (auto &R : mats) {
+            double M[DIM][DIM];
+            mat_by_mat(M, S.T, (double (*)[DIM])R.data());
+            assign_mat(S.T, M);
+        }
+        benchmark::DoNotOptimize(S.T);
+    }
+    state.counters["rotations/s"] = benchmark::Counter(
+        (double)mats.size() * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_mat_by_mat)->DenseRange(0, NUM_INPUTS - 1);
+
+/* Avance de cada 'F' (mat_by_vec y sum_vec) con la orientación de su segmento */
+static void BM_mat_by_vec(benchmark::State &state) {
+    LSystemInterpreter tortuga;
+    std::string desc;
+    std::vector<double> T;
+    double P[DIM] = {0.0, 2.0, 0.0};
+    if (!load_input(state, tortuga, &desc)) return;
+
+    tortuga.read_desc(desc, P);
+    size_t n = tortuga.lines.size();
+    T.resize(n * DIM * DIM);
+    for (size_t i = 0; i < n; i++)
+        tortuga.lines.orientation(i, (double (*)[DIM])&T[i * DIM * DIM]);
+
+    for (auto _ : state) {
+        double X[DIM] = {0.0, 0.0, 0.0};
+        for (size_t i = 0; i < n; i++) {
+            double L[DIM] = {tortuga.lines.length[i], 0.0, 0.0}, D[DIM];
+            mat_by_vec(D, (double (*)[DIM])&T[i * DIM * DIM], L);
+            sum_vec(X, D, X);
+        }
+        benchmark::DoNotOptimize(X);
+    }
+    state.counters["segments/s"] = benchmark::Counter(
+        (double)n * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_mat_by_vec)->DenseRange(0, NUM_INPUTS - 1);
+
+/*
+ * Matriz de OpenGL de cada segmento: assign_GL_mat sobre LineSegment (el
+ * formato anterior, con la orientación ya decodificada) contra
+ * SegmentStore::gl_matrix, que la reconstruye del cuaternión.
+ */
+static void BM_assign_GL_mat(benchmark::State &state) {
+    LSystemInterpreter tortuga;
+    std::string desc;
+    std::vector<double> T;
+    double P[DIM] = {0.0, 2.0, 0.0};
+    if (!load_input(state, tortuga, &desc)) return;
+
+    tortuga.read_desc(desc, P);
+    size_t n = tortuga.lines.size();
+    T.resize(n * DIM * DIM);
+    for (size_t i = 0; i < n; i++)
+        tortuga.lines.orientation(i, (double (*)[DIM])&T[i * DIM * DIM]);
+
+    for (auto _ : state) {
+        LineSegment LS;
+        double sum = 0;
+        for (size_t i = 0; i < n; i++) {
+            tortuga.lines.start_point(i, LS.P0);
+            assign_GL_mat(&LS, (double (*)[DIM])&T[i * DIM * DIM]);
+            sum += LS.T[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.counters["segments/s"] = benchmark::Counter(
+        (double)n * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_assign_GL_mat)->DenseRange(0, NUM_INPUTS - 1);
+
+static void BM_gl_matrix(benchmark::State &state) {
+    LSystemInterpreter tortuga;
+    std::string desc;
+    double P[DIM] = {0.0, 2.0, 0.0};
+    if (!load_input(state, tortuga, &desc)) return;
+
+    tortuga.read_desc(desc, P);
+    size_t n = tortuga.lines.size();
+    for (auto _ : state) {
+        double M[16], sum = 0;
+        for (size_t i = 0; i < n; i++) {
+            tortuga.lines.gl_matrix(i, M);
+            sum += M[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.counters["segments/s"] = benchmark::Counter(
+        (double)n * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_gl_matrix)->DenseRange(0, NUM_INPUTS - 1);
+
+/*
+ * Abrir un archivo y tokenizarlo.  BM_load_parse_ifstream lo lee como lo
+ * hacía load_desc_file antes (ifstream y getline a un std::string);
+ * BM_load_parse_mmap tokeniza directamente sobre el archivo proyectado.
+ */
+static bool load_ifstream(const char *path, double *step, double *angle, std::string *desc) {
+    std::ifstream in(path);
+
+    if (!(in >> *step >> *angle))
+        return false;
+    in >> std::ws;
+    std::getline(in, *desc);
+    return true;
+}
+
+static void BM_load_parse_ifstream(benchmark::State &state) {
+    const char *path = DATA_FILES[state.range(0)];
+    size_t bytes = 0;
+
+    for (auto _ : state) {
+        double step, angle;
+        std::string desc;
+        if (!load_ifstream(path, &step, &angle, &desc)) {
+            state.SkipWithError("no se pudo leer el archivo (ejecutar desde proyecto/)");
+            return;
+        }
+        std::vector<Token> cmds = tokenize(desc);
+        benchmark::DoNotOptimize(cmds.data());
+        bytes = desc.size();
+    }
+    state.SetLabel(path);
+    state.SetBytesProcessed(bytes * state.iterations());
+}
+BENCHMARK(BM_load_parse_ifstream)->DenseRange(0, NUM_DATA_FILES - 1);
+
+static void BM_load_parse_mmap(benchmark::State &state) {
+    const char *path = DATA_FILES[state.range(0)];
+    size_t bytes = 0;
+
+    for (auto _ : state) {
+        DescFile f;
+        if (!f.open(path)) {
+            state.SkipWithError("no se pudo leer el archivo (ejecutar desde proyecto/)");
+            return;
+        }
+        std::vector<Token> cmds = tokenize(f.desc, f.size);
+        benchmark::DoNotOptimize(cmds.data());
+        bytes = f.size;
+    }
+    state.SetLabel(path);
+    state.SetBytesProcessed(bytes * state.iterations());
+}
+BENCHMARK(BM_load_parse_mmap)->DenseRange(0, NUM_DATA_FILES - 1);
+
+/*
+ * Descripciones sintéticas de range(0) MB (la de dol_a.txt repetida), en
+ * /tmp.  Se generan la primera vez y quedan en el caché de páginas, así
+ * que se mide la lectura "en caliente".  A estos tamaños no caben los
+ * comandos en memoria: el análisis solo los cuenta con next_token.
+ */
+static const char *synthetic_file(benchmark::State &state) {
+    static char path[64];
+    size_t target = (size_t)state.range(0) << 20;
+
+    snprintf(path, sizeof(path), "/tmp/lsystem_%ldmb.txt", (long)state.range(0));
+    FILE *f = fopen(path, "rb");
+    if (f) {
+        fseek(f, 0, SEEK_END);
+        size_t size = ftell(f);
+        fclose(f);
+        if (size >= target) return path;
+    }
+
+    double step, angle;
+    std::string desc;
+    if (!load_desc_file("data/dol_a.txt", &step, &angle, &desc) || !(f = fopen(path, "wb")))
+        return NULL;
+    fprintf(f, "%g\n%g\n", step, angle);
+    for (size_t n = 0; n < target; n += desc.size())
+        fwrite(desc.data(), 1, desc.size(), f);
+    fputc('\n', f);
+    fclose(f);
+    return path;
+}
+
+static void BM_load_parse_synthetic(benchmark::State &state) {
+    const char *path = synthetic_file(state);
+    size_t bytes = 0, tokens = 0;
+
+    if (!path) {
+        state.SkipWithError("no se pudo generar el archivo sintético");
+        return;
+    }
+    for (auto _ : state) {
+        DescFile f;
+        Token t;
+        f.open(path);
+        tokens = 0;
+        for (size_t i = 0; i < f.size; )
+            tokens += next_token(f.desc, f.size, &i, &t);
+        bytes = f.size;
+    }
+    state.SetBytesProcessed(bytes * state.iterations());
+    state.counters["symbols/s"] = benchmark::Counter(
+        (double)tokens * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_load_parse_synthetic)->Arg(64)->Arg(1024)->Arg(3072)
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/*
+ * Arranque: desde abrir el archivo hasta tener los segmentos.
+ * BM_startup_text lee data/N.txt (mmap + next_token + tortuga);
+ * BM_startup_lsb lee la misma descripción precompilada a .lsb, que se
+ * genera en /tmp la primera vez.  BM_open_lsb mide solo la apertura con
+ * verificación del checksum, el equivalente a BM_load_parse_mmap.
+ */
+static const char *lsb_file(benchmark::State &state) {
+    static std::string paths[NUM_DATA_FILES];
+    std::string &path = paths[state.range(0)];
+    DescFile f;
+
+    if (!path.empty())
+        return path.c_str();
+    if (!f.open(DATA_FILES[state.range(0)]))
+        return NULL;
+    std::string name = DATA_FILES[state.range(0)];
+    name = "/tmp/lsb_bench_" + name.substr(name.rfind('/') + 1) + ".lsb";
+    if (!lsb_write(name.c_str(), tokenize(f.desc, f.size), f.step, f.angle, DEFAULT_WIDTH))
+        return NULL;
+    path = name;
+    return path.c_str();
+}
+
+static size_t file_size(const char *path) {
+    struct stat st;
+    return stat(path, &st) == 0 ? st.st_size : 0;
+}
+
+static void BM_startup_text(benchmark::State &state) {
+    const char *path = DATA_FILES[state.range(0)];
+    LSystemInterpreter tortuga;
+    double P[] = {0.0, 2.0, 0.0};
+
+    for (auto _ : state) {
+        DescFile f;
+        if (!f.open(path)) {
+            state.SkipWithError("no se pudo leer el archivo (ejecutar desde proyecto/)");
+            return;
+        }
+        tortuga.lstep = f.step;
+        tortuga.langle = f.angle;
+        tortuga.lines.clear();
+        tortuga.read_desc(f.desc, f.size, P);
+        benchmark::DoNotOptimize(tortuga.lines.pos.data());
+    }
+    state.SetLabel(path);
+    state.counters["file_bytes"] = file_size(path);
+    state.counters["segments"] = tortuga.lines.size();
+}
+BENCHMARK(BM_startup_text)->DenseRange(0, NUM_DATA_FILES - 1);
+
+static void BM_startup_lsb(benchmark::State &state) {
+    const char *path = lsb_file(state);
+    LSystemInterpreter tortuga;
+    double P[] = {0.0, 2.0, 0.0};
+
+    if (!path) {
+        state.SkipWithError("no se pudo generar el .lsb (ejecutar desde proyecto/)");
+        return;
+    }
+    for (auto _ : state) {
+        LsbFile f;
+        if (!f.open(path)) {
+            state.SkipWithError("no se pudo leer el .lsb");
+            return;
+        }
+        tortuga.lstep = f.header->lstep;
+        tortuga.langle = f.header->langle;
+        tortuga.lwidth = f.header->lwidth;
+        tortuga.lines.clear();
+        tortuga.read_desc(f.cmds, f.count, P);
+        benchmark::DoNotOptimize(tortuga.lines.pos.data());
+    }
+    state.SetLabel(DATA_FILES[state.range(0)]);
+    state.counters["file_bytes"] = file_size(path);
+    state.counters["segments"] = tortuga.lines.size();
+}
+BENCHMARK(BM_startup_lsb)->DenseRange(0, NUM_DATA_FILES - 1);
+
+static void BM_open_lsb(benchmark::State &state) {
+    const char *path = lsb_file(state);
+
+    if (!path) {
+        state.SkipWithError("no se pudo generar el .lsb (ejecutar desde proyecto/)");
+        return;
+    }
+    for (auto _ : state) {
+        LsbFile f;
+        if (!f.open(path)) {
+            state.SkipWithError("no se pudo leer el .lsb");
+            return;
+        }
+        benchmark::DoNotOptimize(f.cmds);
+    }
+    state.SetLabel(DATA_FILES[state.range(0)]);
+    state.SetBytesProcessed(file_size(path) * state.iterations());
+}
+BENCHMARK(BM_open_lsb)->DenseRange(0, NUM_DATA_FILES - 1);
+
+/* Exportación a PLY de range(1) lados, en /tmp */
+static void BM_export_ply(benchmark::State &state) {
+    LSystemInterpreter tortuga;
+    double P[] = {0.0, 2.0, 0.0};
+    MeshStats stats = {0, 0, 0};
+    std::string desc;
+
+    if (!load_input(state, tortuga, &desc))
+        return;
+    tortuga.read_desc(desc, P);
+    for (auto _ : state)
+        if (!export_ply("/tmp/bench_export.ply", tortuga.lines, state.range(1), &stats)) {
+            state.SkipWithError("no se pudo escribir /tmp/bench_export.ply");
+            return;
+        }
+    state.counters["vertices"] = stats.vertices;
+    state.counters["welded"] = stats.welded;
+    state.counters["segments/s"] = benchmark::Counter(
+        (double)tortuga.lines.size() * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_export_ply)->ArgsProduct({{5, 10, 11}, {6, 12}})->Unit(benchmark::kMillisecond);
+
+/*
+ * BVH: construcción, y recorte a lo largo de un recorrido de cámara como
+ * el del programa (gluLookAt hacia (0, 15, 0) y glFrustum(-10, 10, -10,
+ * 10, 10, 50)): una vuelta completa a distancia 15 y luego un acercamiento
+ * de 15 a 2.  Se informa la fracción de segmentos que queda en las hojas
+ * visibles y los nodos visitados por cuadro.
+ */
+static void BM_bvh_build(benchmark::State &state) {
+    LSystemInterpreter tortuga;
+    double P[] = {0.0, 2.0, 0.0};
+    SegmentBvh bvh;
+    std::string desc;
+
+    if (!load_input(state, tortuga, &desc))
+        return;
+    tortuga.read_desc(desc, P);
+    for (auto _ : state) {
+        bvh.build(tortuga.lines, state.range(1));
+        benchmark::DoNotOptimize(bvh.nodes.data());
+    }
+    state.counters["nodes"] = bvh.nodes.size();
+    state.counters["segments/s"] = benchmark::Counter(
+        (double)tortuga.lines.size() * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_bvh_build)->ArgsProduct({{0, 5, 10, 11}, {8, BVH_LEAF_SIZE, 128}});
+
+/* Matriz de gluLookAt (column-major) */
+static void look_at(const double eye[3], const double at[3], const double up[3], double M[16]) {
+    double f[3], s[3], u[3];
+    double fn = 0, sn = 0;
+
+    for (int d = 0; d < 3; d++) {
+        f[d] = at[d] - eye[d];
+        fn += f[d] * f[d];
+    }
+    for (int d = 0; d < 3; d++) f[d] /= sqrt(fn);
+    s[0] = f[1]*up[2] - f[2]*up[1];
+    s[1] = f[2]*up[0] - f[0]*up[2];
+    s[2] = f[0]*up[1] - f[1]*up[0];
+    for (int d = 0; d < 3; d++) sn += s[d] * s[d];
+    for (int d = 0; d < 3; d++) s[d] /= sqrt(sn);
+    u[0] = s[1]*f[2] - s[2]*f[1];
+    u[1] = s[2]*f[0] - s[0]*f[2];
+    u[2] = s[0]*f[1] - s[1]*f[0];
+
+    for (int c = 0; c < 3; c++) {
+        M[4*c] = s[c];
+        M[4*c + 1] = u[c];
+        M[4*c + 2] = -f[c];
+        M[4*c + 3] = 0;
+    }
+    for (int r = 0; r < 3; r++) {
+        const double *v = r == 0 ? s : r == 1 ? u : f;
+        double t = -(v[0]*eye[0] + v[1]*eye[1] + v[2]*eye[2]);
+        M[12 + r] = r == 2 ? -t : t;
+    }
+    M[15] = 1;
+}
+
+/* Matriz de glFrustum(-10, 10, -10, 10, 10, 50) */
+static void scene_frustum(double M[16]) {
+    const double l = -10, r = 10, b = -10, t = 10, n = 10, f = 50;
+
+    std::fill(M, M + 16, 0.0);
+    M[0] = 2*n / (r - l);
+    M[5] = 2*n / (t - b);
+    M[8] = (r + l) / (r - l);
+    M[9] = (t + b) / (t - b);
+    M[10] = -(f + n) / (f - n);
+    M[11] = -1;
+    M[14] = -2*f*n / (f - n);
+}
+
+#define CAMERA_STEPS    48
+
+/* Cámara del cuadro k del recorrido, como en render_scene */
+static void camera_path(int k, double MV[16]) {
+    double angle = 2 * PI * std::min(k, CAMERA_STEPS / 2) / (CAMERA_STEPS / 2);
+    double distance = k < CAMERA_STEPS / 2 ? 15.0 :
+        15.0 - 13.0 * (k - CAMERA_STEPS / 2) / (CAMERA_STEPS / 2 - 1);
+    double eye[3] = {sin(angle) * distance + 5.0, 20.0, cos(angle) * distance + 3.0};
+    double at[3] = {0.0, 15.0, 0.0}, up[3] = {0.0, 1.0, 0.0};
+
+    look_at(eye, at, up, MV);
+}
+
+static void BM_bvh_cull_path(benchmark::State &state) {
+    LSystemInterpreter tortuga;
+    double P[] = {0.0, 2.0, 0.0};
+    double PR[16], planes[CAMERA_STEPS][6][4];
+    std::vector<uint32_t> leaves;
+    SegmentBvh bvh;
+    std::string desc;
+    size_t visible[2] = {0, 0}, visited = 0, frames = 0;
+
+    if (!load_input(state, tortuga, &desc))
+        return;
+    tortuga.read_desc(desc, P);
+    bvh.build(tortuga.lines, state.range(1));
+
+    scene_frustum(PR);
+    for (int k = 0; k < CAMERA_STEPS; k++) {
+        double MV[16];
+        camera_path(k, MV);
+        frustum_planes(PR, MV, planes[k]);
+    }
+
+    for (auto _ : state) {
+        for (int k = 0; k < CAMERA_STEPS; k++) {
+            CullStats s;
+            leaves.clear();
+            bvh.cull(planes[k], leaves, &s);
+            visible[k >= CAMERA_STEPS / 2] += s.segments;
+            visited += s.nodes;
+            frames++;
+        }
+        benchmark::DoNotOptimize(leaves.data());
+    }
+    state.counters["segments"] = tortuga.lines.size();
+    /* Fracción visible en la vuelta y en el acercamiento */
+    state.counters["orbit_visible"] = 2.0 * visible[0] / frames / tortuga.lines.size();
+    state.counters["zoom_visible"] = 2.0 * visible[1] / frames / tortuga.lines.size();
+    state.counters["nodes/frame"] = (double)visited / frames;
+    state.counters["frames/s"] = benchmark::Counter((double)frames, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_bvh_cull_path)->ArgsProduct({{0, 5, 10, 11}, {8, BVH_LEAF_SIZE, 128}});
+
+/* Derivar los árboles de Honda en memoria; range(0) es la generación */
+static void derive_preset(benchmark::State &state, const char *preset) {
+    LSystem grammar;
+    Derivation derivation;
+    size_t modules = 0;
+
+    if (!grammar.parse(preset)) {
+        state.SkipWithError(grammar.error.c_str());
+        return;
+    }
+    for (auto _ : state) {
+        const ModuleString &str = derivation.run(grammar, state.range(0));
+        modules = str.modules.size();
+        benchmark::DoNotOptimize(str.modules.data());
+    }
+    state.counters["modules"] = modules;
+    state.counters["modules/s"] = benchmark::Counter(
+        (double)modules * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+static void BM_derive_arbol_a(benchmark::State &state) {
+    derive_preset(state, PRESET_ARBOL_A);
+}
+BENCHMARK(BM_derive_arbol_a)->DenseRange(8, 16, 2)->Unit(benchmark::kMillisecond);
+
+static void BM_derive_arbol_g(benchmark::State &state) {
+    derive_preset(state, PRESET_ARBOL_G);
+}
+BENCHMARK(BM_derive_arbol_g)->DenseRange(8, 16, 2)->Unit(benchmark::kMillisecond);
+
+/*
+ * Árbol de Honda de range(0) generaciones hasta los segmentos: en
+ * profundidad (stream_derive) o con la caché de subárboles.  Con
+ * range(1) == 0 la caché parte vacía en cada iteración (se deriva cada
+ * subárbol distinto una vez); con 1 se conserva entre iteraciones, como al
+ * volver a generar el mismo árbol.
+ */
+static void stream_preset(benchmark::State &state, const char *preset) {
+    LSystem grammar;
+    LSystemInterpreter tortuga;
+    double P[DIM] = {0.0, 2.0, 0.0};
+
+    grammar.parse(preset);
+    for (auto _ : state) {
+        tortuga.lines.clear();
+        stream_derive(grammar, state.range(0), tortuga, P);
+    }
+    state.counters["segments/s"] = benchmark::Counter(
+        (double)tortuga.lines.size() * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+static void memo_preset(benchmark::State &state, const char *preset) {
+    LSystem grammar;
+    LSystemInterpreter tortuga;
+    MemoDerivation memo;
+    double P[DIM] = {0.0, 2.0, 0.0};
+    size_t lookups = 0, hits = 0;
+
+    grammar.parse(preset);
+    if (state.range(1))
+        memo.run(grammar, state.range(0), tortuga, P);
+    for (auto _ : state) {
+        if (!state.range(1))
+            memo.clear();
+        tortuga.lines.clear();
+        memo.run(grammar, state.range(0), tortuga, P);
+        lookups += memo.stats.lookups;
+        hits += memo.stats.hits;
+    }
+
+    /*
+     * stream_derive reescribe un módulo A por segmento; con la caché solo
+     * se derivan 'entries' módulos distintos.
+     */
+    state.counters["hit_rate"] = lookups ? (double)hits / lookups : 0.0;
+    state.counters["entries"] = memo.stats.entries;
+    state.counters["segments"] = tortuga.lines.size();
+    state.counters["cache_bytes"] = memo.stats.bytes;
+    state.counters["segments/s"] = benchmark::Counter(
+        (double)tortuga.lines.size() * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+static void BM_stream_arbol_a(benchmark::State &state) {
+    stream_preset(state, PRESET_ARBOL_A);
+}
+BENCHMARK(BM_stream_arbol_a)->DenseRange(8, 16, 4)->Unit(benchmark::kMillisecond);
+
+static void BM_memo_arbol_a(benchmark::State &state) {
+    memo_preset(state, PRESET_ARBOL_A);
+}
+BENCHMARK(BM_memo_arbol_a)->ArgsProduct({{8, 12, 16}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+static void BM_stream_arbol_g(benchmark::State &state) {
+    stream_preset(state, PRESET_ARBOL_G);
+}
+BENCHMARK(BM_stream_arbol_g)->DenseRange(8, 16, 4)->Unit(benchmark::kMillisecond);
+
+static void BM_memo_arbol_g(benchmark::State &state) {
+    memo_preset(state, PRESET_ARBOL_G);
+}
+BENCHMARK(BM_memo_arbol_g)->ArgsProduct({{8, 12, 16}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+/*
+ * Memoria usada por el árbol A según la forma de derivarlo; range(0) es la
+ * generación.  El camino materializado guarda la cadena derivada, su
+ * texto (como lsystem_desc) y sus comandos antes de interpretar; el
+ * camino en profundidad solo guarda la pila de expansión.
+ */
+static void BM_memory_materialized(benchmark::State &state) {
+    LSystem grammar;
+    Derivation derivation;
+    LSystemInterpreter tortuga;
+    double P[DIM] = {0.0, 2.0, 0.0};
+    size_t desc_bytes = 0;
+
+    grammar.parse(PRESET_ARBOL_A);
+    for (auto _ : state) {
+        const ModuleString &str = derivation.run(grammar, state.range(0));
+        std::string desc = to_string(str);
+        std::vector<Token> cmds = tokenize(desc);
+
+        tortuga.lines.clear();
+        tortuga.lines.shrink_to_fit();
+        tortuga.read_desc(cmds, P);
+
+        desc_bytes = 2 * (str.modules.capacity() * sizeof(Module) +
+                          str.params.capacity() * sizeof(double)) +
+                     desc.capacity() + cmds.capacity() * sizeof(Token);
+    }
+    state.counters["desc_bytes"] = desc_bytes;
+    state.counters["lines_bytes"] = tortuga.lines.bytes();
+    state.counters["peak_bytes"] = desc_bytes + tortuga.lines.bytes();
+}
+BENCHMARK(BM_memory_materialized)->DenseRange(6, 16, 2)->Unit(benchmark::kMillisecond);
+
+static void BM_memory_streaming(benchmark::State &state) {
+    LSystem grammar;
+    LSystemInterpreter tortuga;
+    double P[DIM] = {0.0, 2.0, 0.0};
+    size_t depth = 0;
+
+    grammar.parse(PRESET_ARBOL_A);
+    for (auto _ : state) {
+        tortuga.lines.clear();
+        tortuga.lines.shrink_to_fit();
+        depth = stream_derive(grammar, state.range(0), tortuga, P);
+    }
+    state.counters["desc_bytes"] = depth * sizeof(StreamFrame);
+    state.counters["lines_bytes"] = tortuga.lines.bytes();
+    state.counters["peak_bytes"] = depth * sizeof(StreamFrame) + tortuga.lines.bytes();
+}
+BENCHMARK(BM_memory_streaming)->DenseRange(6, 16, 2)->Unit(benchmark::kMillisecond);
+
+/*
+ * Interpretación paralela del árbol A con 18 generaciones (unos 2,6 millones
+ * de comandos); range(0) es la cantidad de hilos.
+ */
+static void BM_read_desc_parallel(benchmark::State &state) {
+    static std::vector<Token> cmds;
+    LSystemInterpreter tortuga;
+    double P[DIM] = {0.0, 2.0, 0.0};
+
+    if (cmds.empty()) {
+        LSystem grammar;
+        Derivation derivation;
+        grammar.parse(PRESET_ARBOL_A);
+        cmds = to_tokens(derivation.run(grammar, 18));
+    }
+    for (auto _ : state) {
+        tortuga.lines.clear();
+        read_desc_parallel(tortuga, cmds, P, state.range(0));
+        benchmark::DoNotOptimize(tortuga.lines.pos.data());
+    }
+    state.counters["symbols/s"] = benchmark::Counter(
+        (double)cmds.size() * state.iterations(), benchmark::Counter::kIsRate);
+    state.counters["segments/s"] = benchmark::Counter(
+        (double)tortuga.lines.size() * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_read_desc_parallel)->RangeMultiplier(2)->Range(1, 16)
+    ->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/*
+ * Bosque de range(0) árboles independientes (alternando A y G con 14
+ * generaciones), repartidos entre todos los núcleos.  Cada hilo usa su
+ * propio intérprete.
+ */
+static void BM_forest(benchmark::State &state) {
+    const char *presets[] = {PRESET_ARBOL_A, PRESET_ARBOL_G};
+    LSystem grammars[2];
+    size_t trees = state.range(0);
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    std::atomic<size_t> segments(0);
+
+    for (int i = 0; i < 2; i++)
+        grammars[i].parse(presets[i]);
+
+    for (auto _ : state) {
+        std::atomic<size_t> next(0);
+        auto worker = [&]() {
+            LSystemInterpreter tortuga;
+            double P[DIM] = {0.0, 2.0, 0.0};
+            for (size_t k; (k = next++) < trees; ) {
+                tortuga.lines.clear();
+                stream_derive(grammars[k % 2], 14, tortuga, P);
+                segments += tortuga.lines.size();
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threads; t++)
+            pool.emplace_back(worker);
+        worker();
+        for (std::thread &t : pool)
+            t.join();
+    }
+    state.counters["threads"] = threads;
+    state.counters["trees/s"] = benchmark::Counter(
+        (double)trees * state.iterations(), benchmark::Counter::kIsRate);
+    state.counters["segments/s"] = benchmark::Counter(
+        (double)segments, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_forest)->Arg(16)->Arg(64)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/*
+ * Bosque de 1000 árboles estocásticos distintos (semillas 0 a 999) con
+ * derive_forest y range(0) hilos (0: uno por núcleo).  'checksum' suma
+ * los segmentos de todos los árboles: no cambia con el número de hilos.
+ */
+static void BM_forest_stochastic(benchmark::State &state) {
+    LSystem grammar;
+    LSystemInterpreter tortuga;
+    double P[DIM] = {0.0, 2.0, 0.0};
+    std::vector<SegmentStore> forest;
+    size_t segments = 0;
+
+    grammar.parse(PRESET_ARBOL_S);
+    for (auto _ : state)
+        derive_forest(grammar, grammar.iterations, tortuga, P, 0, 1000, forest,
+                      state.range(0));
+
+    for (const SegmentStore &s : forest)
+        segments += s.size();
+    state.counters["checksum"] = segments;
+    state.counters["trees/s"] = benchmark::Counter(
+        1000.0 * state.iterations(), benchmark::Counter::kIsRate);
+    state.counters["segments/s"] = benchmark::Counter(
+        (double)segments * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_forest_stochastic)->Arg(1)->Arg(0)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/*
+ * Costo de la búsqueda de contextos: la misma derivación de n
+ * generaciones del árbol A, con y sin una producción sensible al contexto
+ * (que nunca se aplica) para el símbolo A.
+ */
+static void BM_derive_context(benchmark::State &state) {
+    std::string text = PRESET_ARBOL_A;
+    if (state.range(1))
+        text += "p0: F(x) < A(l,w) > B : * -> A(l,w)\n";
+    LSystem grammar;
+    grammar.parse(text);
+    Derivation derivation;
+    size_t modules = 0;
+
+    for (auto _ : state) {
+        const ModuleString &str = derivation.run(grammar, state.range(0));
+        modules = str.modules.size();
+        benchmark::DoNotOptimize(modules);
+    }
+    state.counters["modules/s"] = benchmark::Counter(
+        (double)modules * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_derive_context)->ArgsProduct({{12, 16}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+/*
+ * Subárboles instanciados: detectar las formas de los comandos y elegir el
+ * corte (como --shapes).  Los contadores comparan la memoria de los
+ * segmentos planos (tortuga.lines y lo que sube a la GPU) con la de las
+ * formas y el corte.
+ */
+static void subtree_scene(benchmark::State &state, const std::vector<Token> &cmds,
+                          LSystemInterpreter &tortuga) {
+    double P[DIM] = {0.0, 2.0, 0.0};
+    SubtreeScene scene;
+    SubtreeLayout layout;
+    /* pos, q, width y length: lo que se sube por segmento */
+    const size_t gpu = 3 * sizeof(float) + 4 * sizeof(short) + 2 * sizeof(float);
+
+    tortuga.lines.clear();
+    tortuga.read_desc(cmds, P);
+    tortuga.lines.shrink_to_fit();
+    for (auto _ : state) {
+        scene.build(cmds, tortuga, P);
+        scene.choose_layout(SUBTREE_MAX_INSTANCES, layout);
+    }
+    state.counters["segments"] = tortuga.lines.size();
+    state.counters["shapes"] = scene.shapes.size();
+    state.counters["instances"] = layout.instances.size();
+    state.counters["flat_bytes"] = tortuga.lines.bytes();
+    state.counters["scene_bytes"] = scene.bytes();
+    state.counters["layout_bytes"] = layout.bytes();
+    state.counters["gpu_flat"] = tortuga.lines.size() * gpu;
+    state.counters["gpu_layout"] = layout.segments.size() * gpu;
+    state.counters["segments/s"] = benchmark::Counter(
+        (double)tortuga.lines.size() * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+static void BM_subtree_data(benchmark::State &state) {
+    LSystemInterpreter tortuga;
+    std::string desc;
+
+    if (!load_input(state, tortuga, &desc))
+        return;
+    subtree_scene(state, tokenize(desc), tortuga);
+}
+BENCHMARK(BM_subtree_data)->DenseRange(0, NUM_DATA_FILES - 1);
+
+/* Árboles de Honda de range(0) generaciones */
+static void subtree_preset(benchmark::State &state, const char *preset) {
+    LSystem grammar;
+    Derivation derivation;
+    LSystemInterpreter tortuga;
+
+    grammar.parse(preset);
+    subtree_scene(state, to_tokens(derivation.run(grammar, state.range(0))), tortuga);
+}
+
+static void BM_subtree_arbol_a(benchmark::State &state) {
+    subtree_preset(state, PRESET_ARBOL_A);
+}
+BENCHMARK(BM_subtree_arbol_a)->DenseRange(8, 16, 4)->Unit(benchmark::kMillisecond);
+
+static void BM_subtree_arbol_g(benchmark::State &state) {
+    subtree_preset(state, PRESET_ARBOL_G);
+}
+BENCHMARK(BM_subtree_arbol_g)->DenseRange(8, 16, 4)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
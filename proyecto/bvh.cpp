@@ -0,0 +1,191 @@
+/**
+ * L-systems: BVH de los segmentos y recorte contra el volumen de visión.
+ */
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include "lsystem.h"
+#include "bvh.h"
+
+void SegmentBvh::clear() {
+    nodes.clear();
+    order.clear();
+}
+
+typedef struct {
+    uint32_t node;
+    size_t first;
+    size_t count;
+} BuildTask;
+
+void SegmentBvh::build(const SegmentStore &lines, size_t leaf_size) {
+    size_t n = lines.size();
+    std::vector<float> lo(3 * n), hi(3 * n), mid(3 * n);
+    std::vector<BuildTask> stack;
+
+    clear();
+    if (n == 0)
+        return;
+    if (leaf_size < 1)
+        leaf_size = 1;
+
+    /* Caja de la cápsula de cada segmento */
+    for (size_t i = 0; i < n; i++) {
+        double P0[DIM], P1[DIM];
+        double r = CYL_RADIUS * lines.width[i];
+
+        lines.start_point(i, P0);
+        lines.end_point(i, P1);
+        for (int d = 0; d < DIM; d++) {
+            lo[3*i + d] = (float)(std::min(P0[d], P1[d]) - r);
+            hi[3*i + d] = (float)(std::max(P0[d], P1[d]) + r);
+            mid[3*i + d] = (lo[3*i + d] + hi[3*i + d]) / 2;
+        }
+    }
+
+    order.resize(n);
+    std::iota(order.begin(), order.end(), 0);
+    nodes.reserve(2 * (n / leaf_size + 1));
+
+    BuildTask root = {0, 0, n};
+    nodes.push_back(BvhNode());
+    stack.push_back(root);
+    while (!stack.empty()) {
+        BuildTask t = stack.back();
+        stack.pop_back();
+
+        /* Caja del nodo y de los centros */
+        float box_lo[3], box_hi[3], c_lo[3], c_hi[3];
+        for (int d = 0; d < 3; d++) {
+            box_lo[d] = c_lo[d] = HUGE_VALF;
+            box_hi[d] = c_hi[d] = -HUGE_VALF;
+        }
+        for (size_t k = t.first; k < t.first + t.count; k++) {
+            uint32_t i = order[k];
+            for (int d = 0; d < 3; d++) {
+                box_lo[d] = std::min(box_lo[d], lo[3*i + d]);
+                box_hi[d] = std::max(box_hi[d], hi[3*i + d]);
+                c_lo[d] = std::min(c_lo[d], mid[3*i + d]);
+                c_hi[d] = std::max(c_hi[d], mid[3*i + d]);
+            }
+        }
+
+        BvhNode &node = nodes[t.node];
+        std::copy(box_lo, box_lo + 3, node.lo);
+        std::copy(box_hi, box_hi + 3, node.hi);
+        node.first = (uint32_t)t.first;
+        node.count = (uint32_t)t.count;
+        node.right = 0;
+
+        uint32_t *begin = order.data() + t.first, *end = begin + t.count;
+        if (t.count <= leaf_size) {
+            std::sort(begin, end, [&](uint32_t a, uint32_t b) {
+                return lines.width[a] > lines.width[b] || (lines.width[a] == lines.width[b] && a < b);
+            });
+            continue;
+        }
+
+        int axis = 0;
+        for (int d = 1; d < 3; d++)
+            if (c_hi[d] - c_lo[d] > c_hi[axis] - c_lo[axis]) axis = d;
+        size_t half = t.count / 2;
+        std::nth_element(begin, begin + half, end, [&](uint32_t a, uint32_t b) {
+            return mid[3*a + axis] < mid[3*b + axis];
+        });
+
+        /* Los hijos se reservan juntos; el izquierdo se construye primero */
+        uint32_t left = (uint32_t)nodes.size();
+        nodes.push_back(BvhNode());
+        uint32_t right = (uint32_t)nodes.size();
+        nodes.push_back(BvhNode());
+        nodes[t.node].right = right;
+
+        BuildTask r = {right, t.first + half, t.count - half};
+        BuildTask l = {left, t.first, half};
+        stack.push_back(r);
+        stack.push_back(l);
+    }
+}
+
+void SegmentBvh::cull(const double planes[6][4], std::vector<uint32_t> &leaves,
+                      CullStats *stats) const {
+    /*
+     * Nodo pendiente y bit de cada plano que todavía hay que probar.  La
+     * profundidad es log2(n / leaf_size) + 1 y la pila crece en uno por
+     * nivel.
+     */
+    uint32_t stack[64][2];
+    int sp = 0;
+    CullStats s = {0, 0, 0};
+
+    if (nodes.empty())
+        return;
+    stack[sp][0] = 0;
+    stack[sp][1] = 0x3f;
+    sp++;
+
+    while (sp > 0) {
+        sp--;
+        uint32_t k = stack[sp][0], mask = stack[sp][1];
+        const BvhNode &node = nodes[k];
+        s.nodes++;
+
+        bool outside = false;
+        for (int p = 0; p < 6 && !outside; p++) {
+            if (!(mask & (1u << p))) continue;
+            const double *pl = planes[p];
+            /* Vértice de la caja más adentro (p) y más afuera (n) del plano */
+            double far = pl[3], near = pl[3];
+            for (int d = 0; d < 3; d++) {
+                if (pl[d] >= 0) {
+                    far += pl[d] * node.hi[d];
+                    near += pl[d] * node.lo[d];
+                }
+                else {
+                    far += pl[d] * node.lo[d];
+                    near += pl[d] * node.hi[d];
+                }
+            }
+            if (far < 0)
+                outside = true;
+            else if (near >= 0)
+                mask &= ~(1u << p);
+        }
+        if (outside)
+            continue;
+
+        if (node.right == 0) {
+            leaves.push_back(k);
+            s.leaves++;
+            s.segments += node.count;
+            continue;
+        }
+        stack[sp][0] = node.right;
+        stack[sp][1] = mask;
+        sp++;
+        stack[sp][0] = node.right - 1;
+        stack[sp][1] = mask;
+        sp++;
+    }
+    if (stats) *stats = s;
+}
+
+void frustum_planes(const double proj[16], const double modelview[16], double planes[6][4]) {
+    double M[16];
+
+    /* M = proj * modelview, column-major: M[c*4 + r] */
+    for (int c = 0; c < 4; c++)
+        for (int r = 0; r < 4; r++) {
+            M[c*4 + r] = 0;
+            for (int k = 0; k < 4; k++)
+                M[c*4 + r] += proj[k*4 + r] * modelview[c*4 + k];
+        }
+
+    /* Fila 3 más o menos las filas 0, 1 y 2 */
+    for (int p = 0; p < 6; p++) {
+        int row = p / 2;
+        double sign = p % 2 ? -1.0 : 1.0;
+        for (int c = 0; c < 4; c++)
+            planes[p][c] = M[c*4 + 3] + sign * M[c*4 + row];
+    }
+}
@@ -0,0 +1,71 @@
+/**
+ * L-systems: jerarquía de volúmenes envolventes (BVH) de los segmentos.
+ *
+ * Cada segmento se envuelve en la caja de su cápsula: los extremos P0 y P1
+ * más el radio de la base (CYL_RADIUS * grosor, el mayor del cilindro).
+ * El árbol se construye dividiendo por la mediana de los centros en el eje
+ * más largo hasta que quedan a lo más 'leaf_size' segmentos.  Los dos
+ * hijos de un nodo son nodos contiguos (el izquierdo es right - 1) y cada
+ * nodo cubre un tramo contiguo de 'order', así que los segmentos de una
+ * hoja, o de un subárbol completo, se pueden dibujar con una sola llamada
+ * si se suben en ese orden.
+ *
+ * Dentro de cada hoja los segmentos quedan de mayor a menor grosor, para
+ * que el nivel de detalle de la hoja se elija con una búsqueda binaria
+ * (ver render.h).
+ */
+#ifndef BVH_H
+#define BVH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "segments.h"
+
+/* Segmentos por hoja por omisión */
+#define BVH_LEAF_SIZE   32
+
+typedef struct {
+    float lo[3];
+    float hi[3];
+    uint32_t first;         /* tramo [first, first + count) de order */
+    uint32_t count;
+    uint32_t right;         /* hijo derecho, o 0 si es hoja */
+} BvhNode;
+
+/* Estadísticas de la última llamada a cull() */
+typedef struct {
+    size_t nodes;           /* nodos visitados */
+    size_t leaves;          /* hojas visibles */
+    size_t segments;        /* segmentos en las hojas visibles */
+} CullStats;
+
+class SegmentBvh {
+public:
+    void clear();
+    void build(const SegmentStore &lines, size_t leaf_size = BVH_LEAF_SIZE);
+
+    /*
+     * Agrega a 'leaves' las hojas que no quedan completamente fuera de
+     * alguno de los planos (a, b, c, d), con a*x + b*y + c*z + d >= 0 en
+     * el interior.  Bajo un nodo que está dentro de todos los planos ya no
+     * se prueba nada.
+     */
+    void cull(const double planes[6][4], std::vector<uint32_t> &leaves, CullStats *stats) const;
+
+    bool empty() const { return nodes.empty(); }
+    bool is_leaf(uint32_t k) const { return nodes[k].right == 0; }
+
+    std::vector<BvhNode> nodes;
+    /* Segmento en cada posición del recorrido de las hojas */
+    std::vector<uint32_t> order;
+};
+
+/*
+ * Planos del volumen de visión de la matriz proj * modelview (las dos
+ * column-major, como las entrega glGetDoublev), por el método de Gribb y
+ * Hartmann: izquierdo, derecho, inferior, superior, cercano y lejano.
+ */
+void frustum_planes(const double proj[16], const double modelview[16], double planes[6][4]);
+
+#endif
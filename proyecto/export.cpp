@@ -0,0 +1,340 @@
+/**
+ * L-systems: exportación de los segmentos a PLY y glTF binario.
+ */
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <cfloat>
+#include <string>
+#include <vector>
+#include "lsystem.h"
+#include "export.h"
+
+#define OUT_BUFFER      (1 << 16)
+/* twist[i] de un segmento que no se suelda */
+#define NO_WELD         0xff
+
+/*
+ * Resultado de la primera pasada.  top[i] es el primer vértice del anillo
+ * superior del segmento i.  Si el segmento se suelda, twist[i] es cuántos
+ * lados hay que girar el anillo superior del anterior para que su vértice
+ * k quede junto al vértice k propio (los dos anillos parten de ejes L
+ * distintos si hubo un giro '/' o '\').
+ */
+typedef struct {
+    int slices;
+    std::vector<uint32_t> top;
+    std::vector<unsigned char> twist;
+    MeshStats stats;
+} MeshLayout;
+
+/* Escritura con un buffer propio: los registros son de 4 a 24 bytes */
+class Writer {
+public:
+    Writer() : f(NULL), n(0), ok(true) {}
+    ~Writer() { close(); }
+
+    bool open(const char *path) {
+        f = fopen(path, "wb");
+        ok = f != NULL;
+        return ok;
+    }
+    void put(const void *data, size_t size) {
+        if (n + size > sizeof(buf)) flush();
+        memcpy(buf + n, data, size);
+        n += size;
+    }
+    void flush() {
+        if (n && fwrite(buf, 1, n, f) != n) ok = false;
+        n = 0;
+    }
+    /* Reescribe 'size' bytes en la posición 'offset' del archivo */
+    void patch(long offset, const void *data, size_t size) {
+        flush();
+        long end = ftell(f);
+        if (fseek(f, offset, SEEK_SET) || fwrite(data, 1, size, f) != size ||
+            fseek(f, end, SEEK_SET))
+            ok = false;
+    }
+    bool close() {
+        if (!f) return ok;
+        flush();
+        if (fclose(f)) ok = false;
+        f = NULL;
+        return ok;
+    }
+
+    FILE *f;
+
+private:
+    char buf[OUT_BUFFER];
+    size_t n;
+    bool ok;
+};
+
+static double dot(const double a[DIM], const double b[DIM]) {
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+/* Columna c de la orientación (0: H, 1: L, 2: U) */
+static void column(const double T[DIM][DIM], int c, double v[DIM]) {
+    for (int k = 0; k < DIM; k++)
+        v[k] = T[k][c];
+}
+
+/*
+ * Primera pasada.  Se elige para cada segmento el hijo más alineado (con
+ * empate gana el primero), y luego se numeran los vértices.
+ */
+static bool plan_mesh(const SegmentStore &lines, int slices, MeshLayout &m) {
+    const double min_cos = cos(WELD_MAX_ANGLE * PI / 180.0);
+    size_t n = lines.size(), vertices = 0;
+    std::vector<float> best_cos(n, (float)min_cos);
+    std::vector<uint32_t> best(n, NO_PARENT);
+
+    if (slices < 3 || slices >= NO_WELD || n >= NO_PARENT)
+        return false;
+
+    for (size_t i = 0; i < n; i++) {
+        unsigned int p = lines.parent[i];
+        if (p == NO_PARENT) continue;
+
+        double T[DIM][DIM], Tp[DIM][DIM], H[DIM], Hp[DIM];
+        lines.orientation(i, T);
+        lines.orientation(p, Tp);
+        column(T, 0, H);
+        column(Tp, 0, Hp);
+        float c = (float)dot(H, Hp);
+        if (best[p] == NO_PARENT ? c >= best_cos[p] : c > best_cos[p]) {
+            best_cos[p] = c;
+            best[p] = (uint32_t)i;
+        }
+    }
+
+    m.slices = slices;
+    m.top.resize(n);
+    m.twist.resize(n);
+    m.stats.welded = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        unsigned int p = lines.parent[i];
+        m.twist[i] = NO_WELD;
+
+        if (p != NO_PARENT && best[p] == i) {
+            double T[DIM][DIM], Tp[DIM][DIM], L[DIM], Lp[DIM], Up[DIM];
+            lines.orientation(i, T);
+            lines.orientation(p, Tp);
+            column(T, 1, L);
+            column(Tp, 1, Lp);
+            column(Tp, 2, Up);
+            double a = atan2(dot(L, Up), dot(L, Lp));
+            long o = lround(a * slices / (2 * PI));
+            m.twist[i] = (unsigned char)(((o % slices) + slices) % slices);
+            m.stats.welded++;
+        }
+
+        if (m.twist[i] == NO_WELD)
+            vertices += slices;
+        m.top[i] = (uint32_t)vertices;
+        vertices += slices;
+        if (vertices > UINT32_MAX)
+            return false;
+    }
+    m.stats.vertices = vertices;
+    m.stats.triangles = 2 * n * slices;
+    return true;
+}
+
+static void put_ring(Writer &out, const double C[DIM], const double H[DIM],
+                     const double L[DIM], const double U[DIM], double r, double slope,
+                     const std::vector<double> &cs, const std::vector<double> &sn,
+                     float bmin[DIM], float bmax[DIM]) {
+    /* Normal del cono: radial, inclinada hacia H según lo que se angosta */
+    double scale = 1.0 / sqrt(1.0 + slope * slope);
+
+    for (size_t k = 0; k < cs.size(); k++) {
+        float v[6];
+        for (int j = 0; j < DIM; j++) {
+            double d = cs[k] * L[j] + sn[k] * U[j];
+            v[j] = (float)(C[j] + r * d);
+            v[DIM + j] = (float)((d + slope * H[j]) * scale);
+            if (v[j] < bmin[j]) bmin[j] = v[j];
+            if (v[j] > bmax[j]) bmax[j] = v[j];
+        }
+        out.put(v, sizeof(v));
+    }
+}
+
+/* Segunda pasada: posiciones y normales (6 float por vértice) */
+static void put_vertices(Writer &out, const SegmentStore &lines, const MeshLayout &m,
+                         float bmin[DIM], float bmax[DIM]) {
+    std::vector<double> cs(m.slices), sn(m.slices);
+
+    for (int k = 0; k < m.slices; k++) {
+        cs[k] = cos(2 * PI * k / m.slices);
+        sn[k] = sin(2 * PI * k / m.slices);
+    }
+    for (int j = 0; j < DIM; j++) {
+        bmin[j] = FLT_MAX;
+        bmax[j] = -FLT_MAX;
+    }
+
+    for (size_t i = 0; i < lines.size(); i++) {
+        double T[DIM][DIM], H[DIM], L[DIM], U[DIM], P0[DIM], P1[DIM];
+        double r0 = CYL_RADIUS * lines.width[i], r1 = r0 * CYL_TAPER;
+        double len = lines.length[i];
+        double slope = len > 0 ? (r0 - r1) / len : 0.0;
+
+        lines.orientation(i, T);
+        column(T, 0, H);
+        column(T, 1, L);
+        column(T, 2, U);
+        lines.start_point(i, P0);
+        for (int j = 0; j < DIM; j++)
+            P1[j] = P0[j] + len * H[j];
+
+        if (m.twist[i] == NO_WELD)
+            put_ring(out, P0, H, L, U, r0, slope, cs, sn, bmin, bmax);
+        put_ring(out, P1, H, L, U, r1, slope, cs, sn, bmin, bmax);
+    }
+}
+
+/*
+ * Tercera pasada: triángulos.  Con H x L = -U (ver segments.h) el orden
+ * (b_k, t_k, b_k+1) deja las caras hacia afuera del tubo.  En PLY cada
+ * cara lleva antes su cantidad de vértices.
+ */
+static void put_faces(Writer &out, const SegmentStore &lines, const MeshLayout &m, bool ply) {
+    const unsigned char three = 3;
+    const uint32_t K = m.slices;
+
+    for (size_t i = 0; i < lines.size(); i++) {
+        uint32_t top = m.top[i], bottom = top - K, twist = 0;
+        if (m.twist[i] != NO_WELD) {
+            bottom = m.top[lines.parent[i]];
+            twist = m.twist[i];
+        }
+
+        for (uint32_t k = 0; k < K; k++) {
+            uint32_t k1 = (k + 1) % K;
+            uint32_t b0 = bottom + (k + twist) % K, b1 = bottom + (k1 + twist) % K;
+            uint32_t tri[2][3] = {{b0, top + k, b1}, {top + k, top + k1, b1}};
+            for (int t = 0; t < 2; t++) {
+                if (ply) out.put(&three, 1);
+                out.put(tri[t], sizeof(tri[t]));
+            }
+        }
+    }
+}
+
+bool export_ply(const char *path, const SegmentStore &lines, int slices, MeshStats *stats) {
+    MeshLayout m;
+    Writer out;
+    float bmin[DIM], bmax[DIM];
+    char header[512];
+
+    if (!plan_mesh(lines, slices, m) || !out.open(path))
+        return false;
+
+    int len = snprintf(header, sizeof(header),
+        "ply\n"
+        "format binary_little_endian 1.0\n"
+        "comment L-system: %zu segmentos, %d lados\n"
+        "element vertex %zu\n"
+        "property float x\nproperty float y\nproperty float z\n"
+        "property float nx\nproperty float ny\nproperty float nz\n"
+        "element face %zu\n"
+        "property list uchar uint vertex_indices\n"
+        "end_header\n",
+        lines.size(), slices, m.stats.vertices, m.stats.triangles);
+    out.put(header, len);
+    put_vertices(out, lines, m, bmin, bmax);
+    put_faces(out, lines, m, true);
+
+    if (stats) *stats = m.stats;
+    return out.close();
+}
+
+/*
+ * JSON del glTF.  Las cotas de POSITION se conocen recién después de
+ * escribir los vértices, así que primero se escribe con espacio de sobra y
+ * al final se reescribe en el mismo lugar (el relleno del JSON son
+ * espacios, como pide la especificación).
+ */
+static std::string gltf_json(const MeshStats &s, const float bmin[DIM], const float bmax[DIM]) {
+    size_t vbytes = s.vertices * 6 * sizeof(float);
+    size_t ibytes = s.triangles * 3 * sizeof(uint32_t);
+    char buf[2048];
+
+    snprintf(buf, sizeof(buf),
+        "{\"asset\":{\"version\":\"2.0\",\"generator\":\"proyecto (L-systems)\"},"
+        "\"scene\":0,\"scenes\":[{\"nodes\":[0]}],\"nodes\":[{\"mesh\":0}],"
+        "\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":0,\"NORMAL\":1},\"indices\":2}]}],"
+        "\"buffers\":[{\"byteLength\":%zu}],"
+        "\"bufferViews\":["
+        "{\"buffer\":0,\"byteOffset\":0,\"byteLength\":%zu,\"byteStride\":24,\"target\":34962},"
+        "{\"buffer\":0,\"byteOffset\":%zu,\"byteLength\":%zu,\"target\":34963}],"
+        "\"accessors\":["
+        "{\"bufferView\":0,\"byteOffset\":0,\"componentType\":5126,\"count\":%zu,\"type\":\"VEC3\","
+        "\"min\":[%.9g,%.9g,%.9g],\"max\":[%.9g,%.9g,%.9g]},"
+        "{\"bufferView\":0,\"byteOffset\":12,\"componentType\":5126,\"count\":%zu,\"type\":\"VEC3\"},"
+        "{\"bufferView\":1,\"byteOffset\":0,\"componentType\":5125,\"count\":%zu,\"type\":\"SCALAR\"}]}",
+        vbytes + ibytes, vbytes, vbytes, ibytes, s.vertices,
+        bmin[0], bmin[1], bmin[2], bmax[0], bmax[1], bmax[2],
+        s.vertices, s.triangles * 3);
+    return buf;
+}
+
+static void put_u32(Writer &out, uint32_t v) {
+    out.put(&v, sizeof(v));
+}
+
+bool export_glb(const char *path, const SegmentStore &lines, int slices, MeshStats *stats) {
+    MeshLayout m;
+    Writer out;
+    float bmin[DIM] = {-FLT_MAX, -FLT_MAX, -FLT_MAX}, bmax[DIM] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+
+    if (!plan_mesh(lines, slices, m) || !out.open(path))
+        return false;
+
+    /* Espacio para el JSON con las cotas más largas posibles */
+    std::string json = gltf_json(m.stats, bmin, bmax);
+    size_t json_len = (json.size() + 3) & ~(size_t)3;
+    size_t bin_len = m.stats.vertices * 6 * sizeof(float) + m.stats.triangles * 3 * sizeof(uint32_t);
+    size_t total = 12 + 8 + json_len + 8 + bin_len;
+    if (total > UINT32_MAX)
+        return false;
+
+    put_u32(out, 0x46546C67);           /* "glTF" */
+    put_u32(out, 2);
+    put_u32(out, (uint32_t)total);
+    put_u32(out, (uint32_t)json_len);
+    put_u32(out, 0x4E4F534A);           /* "JSON" */
+    long json_offset = 20;
+    json.resize(json_len, ' ');
+    out.put(json.data(), json_len);
+    put_u32(out, (uint32_t)bin_len);
+    put_u32(out, 0x004E4942);           /* "BIN" */
+
+    put_vertices(out, lines, m, bmin, bmax);
+    put_faces(out, lines, m, false);
+
+    json = gltf_json(m.stats, bmin, bmax);
+    json.resize(json_len, ' ');
+    out.patch(json_offset, json.data(), json_len);
+
+    if (stats) *stats = m.stats;
+    return out.close();
+}
+
+bool export_mesh(const char *path, const SegmentStore &lines, int slices, MeshStats *stats) {
+    const char *ext = strrchr(path, '.');
+
+    if (ext && !strcmp(ext, ".ply"))
+        return export_ply(path, lines, slices, stats);
+    if (ext && !strcmp(ext, ".glb"))
+        return export_glb(path, lines, slices, stats);
+    fprintf(stderr, "%s: formato desconocido (se espera .ply o .glb)\n", path);
+    return false;
+}
@@ -0,0 +1,45 @@
+/**
+ * L-systems: exportación de los segmentos a una malla indexada.
+ *
+ * Cada segmento se tesela como un tubo de 'slices' lados (sin tapas, igual
+ * que gluCylinder) con normales por vértice.  Cuando un segmento continúa
+ * a otro de la misma rama (SegmentStore::parent) y el giro entre ambos es
+ * menor que WELD_MAX_ANGLE, su anillo inferior es el anillo superior del
+ * anterior: el tronco queda como un solo tubo soldado y se ahorra un
+ * anillo por segmento.
+ *
+ * La malla no se arma en memoria.  Una primera pasada decide qué
+ * segmentos se sueldan y cuenta vértices y triángulos (5 bytes por
+ * segmento); la segunda escribe los vértices y la tercera los triángulos,
+ * los dos a través de un buffer de tamaño fijo.  Así se pueden exportar
+ * árboles de millones de segmentos sin pasar por OpenGL.
+ *
+ * Formatos (por la extensión del archivo):
+ *   .ply   PLY binario little-endian: x y z nx ny nz (float) y caras
+ *          "list uchar uint"
+ *   .glb   glTF 2.0 binario: un buffer con posiciones y normales
+ *          intercaladas y los índices (uint32)
+ */
+#ifndef EXPORT_H
+#define EXPORT_H
+
+#include <cstddef>
+#include "segments.h"
+
+/* Lados de cada tubo por omisión */
+#define EXPORT_SLICES   12
+/* Giro máximo (grados) entre un segmento y el que continúa para soldarlos */
+#define WELD_MAX_ANGLE  60.0
+
+typedef struct {
+    size_t vertices;
+    size_t triangles;
+    size_t welded;          /* segmentos que comparten su anillo inferior */
+} MeshStats;
+
+bool export_ply(const char *path, const SegmentStore &lines, int slices, MeshStats *stats);
+bool export_glb(const char *path, const SegmentStore &lines, int slices, MeshStats *stats);
+/* Elige el formato por la extensión (.ply o .glb) */
+bool export_mesh(const char *path, const SegmentStore &lines, int slices, MeshStats *stats);
+
+#endif
@@ -0,0 +1,18 @@
+/**
+ * L-systems: dibujo sin ventana.
+ *
+ * Crea un contexto de OpenGL sobre un pbuffer de EGL, de preferencia en la
+ * plataforma "surfaceless" de Mesa, que no necesita servidor gráfico ni GPU
+ * (con llvmpipe todo se dibuja en la CPU).  Sirve para generar imágenes y
+ * medir tiempos en máquinas sin pantalla.
+ */
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+/* Crea el contexto y lo deja activo; devuelve false si no se pudo */
+bool headless_init(int width, int height);
+void headless_release();
+/* Guarda el buffer de color actual como imagen PPM (P6) */
+bool write_ppm(const char *path, int width, int height);
+
+#endif
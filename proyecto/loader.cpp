@@ -0,0 +1,113 @@
+/**
+ * L-systems: lectura de descripciones con mmap.
+ */
+#include <cstdio>
+#include <cstring>
+#include <charconv>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "loader.h"
+
+static bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+/* Lee un número después de saltar espacios; avanza *p */
+static bool read_number(const char **p, const char *end, double *value) {
+    while (*p < end && is_space(**p))
+        (*p)++;
+    std::from_chars_result r = std::from_chars(*p, end, *value);
+    if (r.ec != std::errc())
+        return false;
+    *p = r.ptr;
+    return true;
+}
+
+DescFile::DescFile()
+    : step(0), angle(0), desc(NULL), size(0), map(NULL), map_size(0) {
+}
+
+DescFile::~DescFile() {
+    close();
+}
+
+void DescFile::close() {
+    if (map) {
+        munmap(map, map_size);
+        map = NULL;
+        map_size = 0;
+    }
+    buffer.clear();
+    buffer.shrink_to_fit();
+    desc = NULL;
+    size = 0;
+}
+
+bool DescFile::open(const char *path) {
+    bool use_stdin = path == NULL || !strcmp(path, "-");
+    int fd = use_stdin ? STDIN_FILENO : ::open(path, O_RDONLY);
+    struct stat st;
+    bool ok = false;
+
+    close();
+    if (fd < 0)
+        return false;
+
+    bool done = false;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        /* Con '<' la entrada estándar puede no estar al comienzo */
+        off_t start = use_stdin ? lseek(fd, 0, SEEK_CUR) : 0;
+        if (start < 0) start = 0;
+
+        if (start >= st.st_size) {
+            /* Ya se leyó todo: no queda nada que proyectar */
+            ok = parse(NULL, 0);
+            done = true;
+        }
+        else {
+            map_size = st.st_size;
+            map = mmap(NULL, map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map == MAP_FAILED) {
+                /* Se lee con read() desde la posición actual, como un pipe */
+                map = NULL;
+                map_size = 0;
+            }
+            else {
+                madvise(map, map_size, MADV_SEQUENTIAL);
+                ok = parse((const char *)map + start, map_size - start);
+                done = true;
+            }
+        }
+    }
+    if (!done) {
+        /* Pipe, terminal o archivo que no se pudo proyectar: se lee completo */
+        char chunk[1 << 16];
+        ssize_t n;
+        while ((n = read(fd, chunk, sizeof(chunk))) > 0)
+            buffer.insert(buffer.end(), chunk, chunk + n);
+        ok = parse(buffer.data(), buffer.size());
+    }
+
+    if (!use_stdin)
+        ::close(fd);
+    if (!ok)
+        close();
+    return ok;
+}
+
+/* Paso y ángulo, y luego la descripción hasta el fin de línea */
+bool DescFile::parse(const char *data, size_t length) {
+    const char *p = data, *end = data + length;
+
+    if (!read_number(&p, end, &step) || !read_number(&p, end, &angle))
+        return false;
+    while (p < end && is_space(*p))
+        p++;
+
+    const char *eol = (const char *)memchr(p, '\n', end - p);
+    desc = p;
+    size = (eol ? eol : end) - p;
+    return true;
+}
@@ -0,0 +1,42 @@
+/**
+ * L-systems: lectura de descripciones sin copiarlas.
+ *
+ * Un archivo en el formato de data/N.txt (paso, ángulo y descripción) se
+ * proyecta en memoria con mmap y la descripción se interpreta directamente
+ * sobre los bytes proyectados.  La entrada estándar también se proyecta si
+ * está redirigida desde un archivo (./proyecto < data/1.txt); si es un
+ * pipe, o si mmap falla, se lee completa a un buffer.
+ */
+#ifndef LOADER_H
+#define LOADER_H
+
+#include <cstddef>
+#include <vector>
+
+class DescFile {
+public:
+    DescFile();
+    ~DescFile();
+
+    /* Abre 'path', o la entrada estándar si es NULL o "-" */
+    bool open(const char *path);
+    void close();
+
+    double step;
+    double angle;
+    /* Descripción (la línea que sigue al ángulo), sin terminar en '\0' */
+    const char *desc;
+    size_t size;
+
+private:
+    DescFile(const DescFile &);
+    DescFile &operator=(const DescFile &);
+
+    bool parse(const char *data, size_t length);
+
+    void *map;
+    size_t map_size;
+    std::vector<char> buffer;
+};
+
+#endif
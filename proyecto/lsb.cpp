@@ -0,0 +1,138 @@
+/**
+ * L-systems: lectura y escritura de archivos .lsb.
+ */
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "lsb.h"
+
+/*
+ * Hash al estilo FNV en cuatro carriles: el primo de FNV aplicado a
+ * palabras de 64 bits en carriles independientes (y byte a byte en la
+ * cola), que al final se combinan entre sí y con el largo.  No coincide
+ * con FNV-1a estándar.  Recorrer de a un byte limitaba la apertura a
+ * ~550 MB/s, más lento que analizar el texto equivalente.
+ */
+uint64_t lsb_checksum(const void *data, size_t size) {
+    const uint64_t PRIME = 1099511628211ull;
+    const unsigned char *p = (const unsigned char *)data;
+    uint64_t h[4] = {14695981039346656037ull, 1, 2, 3};
+    size_t i = 0;
+
+    for (; i + 32 <= size; i += 32)
+        for (int k = 0; k < 4; k++) {
+            uint64_t w;
+            memcpy(&w, p + i + 8 * k, 8);
+            h[k] = (h[k] ^ w) * PRIME;
+        }
+    for (; i < size; i++)
+        h[0] = (h[0] ^ p[i]) * PRIME;
+
+    for (int k = 1; k < 4; k++)
+        h[0] = (h[0] ^ h[k]) * PRIME;
+    return h[0] ^ size;
+}
+
+bool lsb_probe(const char *path) {
+    char magic[4];
+    FILE *f = fopen(path, "rb");
+    bool ok;
+
+    if (!f) return false;
+    ok = fread(magic, 1, 4, f) == 4 && !memcmp(magic, LSB_MAGIC, 4);
+    fclose(f);
+    return ok;
+}
+
+bool lsb_write(const char *path, const std::vector<Token> &cmds,
+               double lstep, double langle, double lwidth) {
+    std::vector<Token> out(cmds.size());
+    LsbHeader h;
+    FILE *f;
+
+    /* Copiar campo a campo para que los bytes de relleno queden en cero */
+    memset(out.data(), 0, out.size() * sizeof(Token));
+    memset(&h, 0, sizeof(h));
+    for (size_t i = 0; i < cmds.size(); i++) {
+        out[i].op = cmds[i].op;
+        out[i].has_arg = cmds[i].has_arg;
+        out[i].arg = cmds[i].arg;
+        if (cmds[i].op == OP_FORWARD) h.segments++;
+    }
+
+    memcpy(h.magic, LSB_MAGIC, 4);
+    h.version = LSB_VERSION;
+    h.lstep = lstep;
+    h.langle = langle;
+    h.lwidth = lwidth;
+    h.count = out.size();
+    h.checksum = lsb_checksum(out.data(), out.size() * sizeof(Token));
+
+    if (!(f = fopen(path, "wb")))
+        return false;
+    bool ok = fwrite(&h, sizeof(h), 1, f) == 1 &&
+              fwrite(out.data(), sizeof(Token), out.size(), f) == out.size();
+    return fclose(f) == 0 && ok;
+}
+
+LsbFile::LsbFile()
+    : header(NULL), cmds(NULL), count(0), map(NULL), map_size(0) {
+}
+
+LsbFile::~LsbFile() {
+    close();
+}
+
+void LsbFile::close() {
+    if (map) {
+        munmap(map, map_size);
+        map = NULL;
+        map_size = 0;
+    }
+    header = NULL;
+    cmds = NULL;
+    count = 0;
+}
+
+bool LsbFile::open(const char *path, bool verify) {
+    struct stat st;
+    int fd = ::open(path, O_RDONLY);
+
+    close();
+    if (fd < 0)
+        return false;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(LsbHeader)) {
+        ::close(fd);
+        return false;
+    }
+    map_size = st.st_size;
+    map = mmap(NULL, map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        map = NULL;
+        map_size = 0;
+        return false;
+    }
+
+    const LsbHeader *h = (const LsbHeader *)map;
+    size_t bytes = map_size - sizeof(LsbHeader);
+    if (memcmp(h->magic, LSB_MAGIC, 4) || h->version != LSB_VERSION ||
+        h->count != bytes / sizeof(Token) || bytes % sizeof(Token)) {
+        fprintf(stderr, "%s: archivo .lsb inválido o de otra versión\n", path);
+        close();
+        return false;
+    }
+    if (verify && lsb_checksum(h + 1, bytes) != h->checksum) {
+        fprintf(stderr, "%s: checksum incorrecto\n", path);
+        close();
+        return false;
+    }
+
+    header = h;
+    cmds = (const Token *)(h + 1);
+    count = h->count;
+    return true;
+}
@@ -0,0 +1,73 @@
+/**
+ * L-systems: formato binario de comandos ya tokenizados (.lsb).
+ *
+ * Un archivo .lsb es una cabecera seguida del arreglo de Token tal como
+ * está en memoria, así que se proyecta con mmap y el intérprete lo recorre
+ * sin analizar texto.  Los enteros y flotantes van en el orden de bytes de
+ * la máquina (little-endian en x86); la cabecera permite detectar un
+ * archivo de otra versión o dañado.
+ *
+ *   magic     "LSB\x1a"
+ *   version   LSB_VERSION
+ *   lstep, langle, lwidth
+ *   count     cantidad de comandos
+ *   segments  cantidad de 'F'
+ *   checksum  hash de 64 bits de los bytes de los comandos, al estilo FNV
+ *             en 4 carriles de palabras de 64 bits (no es FNV-1a; lsb.cpp)
+ */
+#ifndef LSB_H
+#define LSB_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "lsystem.h"
+
+#define LSB_MAGIC       "LSB\x1a"
+#define LSB_VERSION     1
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    double lstep;
+    double langle;
+    double lwidth;
+    uint64_t count;
+    uint64_t segments;
+    uint64_t checksum;
+} LsbHeader;
+
+/* El archivo guarda los Token tal cual: su tamaño es parte del formato */
+static_assert(sizeof(Token) == 8, "Token debe medir 8 bytes");
+static_assert(sizeof(LsbHeader) == 56, "LsbHeader debe medir 56 bytes");
+
+class LsbFile {
+public:
+    LsbFile();
+    ~LsbFile();
+
+    /* Proyecta el archivo; con 'verify' también revisa el checksum */
+    bool open(const char *path, bool verify = true);
+    void close();
+
+    const LsbHeader *header;
+    const Token *cmds;
+    size_t count;
+
+private:
+    LsbFile(const LsbFile &);
+    LsbFile &operator=(const LsbFile &);
+
+    void *map;
+    size_t map_size;
+};
+
+/* Hash de 64 bits al estilo FNV en 4 carriles (no FNV-1a estándar), ver lsb.cpp */
+uint64_t lsb_checksum(const void *data, size_t size);
+/* true si el archivo empieza con LSB_MAGIC */
+bool lsb_probe(const char *path);
+/* Escribe los comandos con los parámetros del intérprete */
+bool lsb_write(const char *path, const std::vector<Token> &cmds,
+               double lstep, double langle, double lwidth);
+
+#endif
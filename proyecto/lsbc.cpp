@@ -0,0 +1,34 @@
+/**
+ * Conversor de descripciones de L-systems al formato binario .lsb.
+ *
+ * Para compilar: make lsbc
+ * Para ejecutar: ./lsbc data/dol_a.txt data/dol_a.lsb
+ *            o:  make lsb   (convierte todos los data/N.txt)
+ */
+#include <cstdio>
+#include <cstdlib>
+#include "lsystem.h"
+#include "loader.h"
+#include "lsb.h"
+
+int main(int argc, char *argv[]) {
+    DescFile in;
+
+    if (argc != 3) {
+        fprintf(stderr, "Uso: %s entrada.txt salida.lsb\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (!in.open(argv[1])) {
+        fprintf(stderr, "No se pudo leer %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Token> cmds = tokenize(in.desc, in.size);
+    if (!lsb_write(argv[2], cmds, in.step, in.angle, DEFAULT_WIDTH)) {
+        fprintf(stderr, "No se pudo escribir %s\n", argv[2]);
+        return EXIT_FAILURE;
+    }
+    printf("%s: %zu bytes -> %s: %zu comandos, %zu bytes\n", argv[1], in.size,
+           argv[2], cmds.size(), sizeof(LsbHeader) + cmds.size() * sizeof(Token));
+    return EXIT_SUCCESS;
+}
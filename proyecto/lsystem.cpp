@@ -0,0 +1,549 @@
+/**
+ * L-systems: intérprete de tortuga.
+ * Basado en el libro de A. Lindenmayer "The Algorithmic Beauty of Plants"
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <cstdint>
+#include <charconv>
+#include "lsystem.h"
+#include "loader.h"
+#include "trace.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* Profundidad de ramas para la que se reserva la pila de estados */
+#define STACK_RESERVE   64
+/* Tamaño (log2) de la tabla de senos y cosenos */
+#define TRIG_CACHE_BITS 6
+
+/* Operaciones sobre matrices */
+
+/* Multiplicación de matrices */
+void mat_by_mat(double result[DIM][DIM], double A[DIM][DIM], double B[DIM][DIM]) {
+    int i, j, k;
+    double sum;
+    for (i = 0; i < DIM; i++) {
+        for (j = 0; j < DIM; j++) {
+            sum = 0.0;
+            for (k = 0; k < DIM; k++) {
+                sum += A[i][k] * B[k][j];
+            }
+            result[i][j] = sum;
+        }
+    }
+}
+
+/* Guarda el resultado de una matriz en otra */
+void assign_mat(double result[DIM][DIM], double M[DIM][DIM]) {
+    int i, j;
+    for (i = 0; i < DIM; i++)
+        for (j = 0; j < DIM; j++)
+            result[i][j] = M[i][j];
+}
+
+/* Guarda el resultado de un vector en otro */
+void assign_vec(double result[DIM], double A[DIM]) {
+    int i;
+    for (i = 0; i < DIM; i++)
+        result[i] = A[i];
+}
+
+/* Imprimir matriz */
+void print_mat(double M[DIM][DIM]) {
+    int i, j;
+    printf("\n");
+    for (i = 0; i < DIM; i++) {
+        for (j = 0; j < DIM; j++)
+            printf("%f ", M[i][j]);
+        printf("\n");
+    }
+    printf("\n");
+}
+
+/* Imprimir vector */
+void print_vec(double A[DIM]) {
+    int i;
+    printf("\n");
+    for (i = 0; i < DIM; i++)
+        printf("%f ", A[i]);
+    printf("\n\n");
+}
+
+/* Multiplica matriz por vector */
+void mat_by_vec(double result[DIM], double M[DIM][DIM], double V[DIM]) {
+    int i, j;
+    for (i = 0; i < DIM; i++) {
+        result[i] = 0;
+        for (j = 0; j < DIM; j++)
+            result[i] += M[i][j] * V[j];
+    }
+}
+
+/* Suma dos vectores */
+void sum_vec(double result[DIM], double A[DIM], double B[DIM]) {
+    int i;
+    for (i = 0; i < DIM; i++)
+        result[i] = A[i] + B[i];
+}
+
+/*
+ * Matrices de transformación
+ */
+
+/* Rotar en torno a eje U (Z) */
+void Ru_matrix(double R[DIM][DIM], double angle) {
+    double alfa = (angle * PI)/180.0;
+    double mat[DIM][DIM] = {
+        {cos(alfa), sin(alfa), 0},
+        {sin(alfa * -1.0), cos(alfa), 0},
+        {0, 0, 1}
+    };
+    assign_mat(R, mat);
+}
+
+/* Rotar en torno a eje Z */
+void Rz_matrix(double R[DIM][DIM], double angle) {
+    double alfa = (angle * PI)/180.0;
+    double mat[DIM][DIM] = {
+        {cos(alfa), sin(alfa * -1.0), 0},
+        {sin(alfa), cos(alfa), 0},
+        {0, 0, 1}
+    };
+    assign_mat(R, mat);
+}
+
+/* Rotar en torno a eje L (Y) */
+void Rl_matrix(double R[DIM][DIM], double angle) {
+    double alfa = (angle * PI)/180.0;
+    double mat[DIM][DIM] = {
+        {cos(alfa), 0, sin(alfa * -1.0)},
+        {0, 1, 0},
+        {sin(alfa), 0, cos(alfa)}
+    };
+    assign_mat(R, mat);
+}
+
+/* Rotar en torno a eje Y */
+void Ry_matrix(double R[DIM][DIM], double angle) {
+    double alfa = (angle * PI)/180.0;
+    double mat[DIM][DIM] = {
+        {cos(alfa), 0, sin(alfa)},
+        {0, 1, 0},
+        {sin(alfa * -1.0), 0, cos(alfa)}
+    };
+    assign_mat(R, mat);
+}
+
+/* Rotar en torno a eje H (X) */
+void Rh_matrix(double R[DIM][DIM], double angle) {
+    double alfa = (angle * PI)/180.0;
+    double mat[DIM][DIM] = {
+        {1, 0, 0},
+        {0, cos(alfa), sin(alfa * -1.0)},
+        {0, sin(alfa), cos(alfa)}
+    };
+    assign_mat(R, mat);
+}
+
+/* Rotar en torno a eje X */
+void Rx_matrix(double R[DIM][DIM], double angle) {
+    double alfa = (angle * PI)/180.0;
+    double mat[DIM][DIM] = {
+        {1, 0, 0},
+        {0, cos(alfa), sin(alfa * -1.0)},
+        {0, sin(alfa), cos(alfa)}
+    };
+    assign_mat(R, mat);
+}
+
+void assign_GL_mat(LineSegment *LS, double M[DIM][DIM])
+{
+	double T[DIM][DIM], R[DIM][DIM];
+	//printf("M matrix:\n");
+	//print_mat(M);
+	Ry_matrix(R, 90.0);
+    /* Aplicar la transformación R a T: T*R */
+	mat_by_mat(T, M, R);
+	
+	//printf("T matrix:\n");
+	//print_mat(T);
+                
+	LS->T[0] = T[0][0];
+	LS->T[1] = T[1][0];
+	LS->T[2] = T[2][0];
+	LS->T[3] = 0.0;
+	LS->T[4] = T[0][1];
+	LS->T[5] = T[1][1];
+	LS->T[6] = T[2][1];
+	LS->T[7] = 0.0;
+	LS->T[8] = T[0][2];
+	LS->T[9] = T[1][2];
+	LS->T[10] = T[2][2];
+	LS->T[11] = 0.0;
+	LS->T[12] = LS->P0[0];
+	LS->T[13] = LS->P0[1];
+	LS->T[14] = LS->P0[2];
+	LS->T[15] = 1.0;
+}
+
+/*
+ * Leer el argumento entre paréntesis que sigue al símbolo en 'start'.
+ * Asumimos que la string es una cadena bien formada (con paréntesis
+ * balanceados).  El número se convierte directamente desde la
+ * descripción con std::from_chars, sin copias intermedias.  Además,
+ * calcular la cantidad de caractéres que hemos leído.
+ * Si no hay argumento, 0 caracteres son leídos.
+ */
+void get_argument(const char *desc, size_t size, size_t start, double *arg, int *jump) {
+    size_t i = start + 2;
+
+    TRACE_COUNT(TRACE_GET_ARGUMENT, 1);
+
+    if (start + 1 < size && desc[start + 1] == '(') {
+        /* from_chars no acepta espacios ni '+' iniciales (atof sí) */
+        while (i < size && (desc[i] == ' ' || desc[i] == '+'))
+            i++;
+
+        *arg = 0.0;
+        std::from_chars(desc + i, desc + size, *arg);
+
+        while (i < size && desc[i] != ')')
+            i++;
+        *jump = (int)(i - start);
+    }
+    else
+        /* Un salto de 0 significa que no hay argumento */
+        *jump = 0;
+}
+
+/* Código de operación asociado a un símbolo, o -1 si no tiene interpretación */
+int opcode_of(char c) {
+    switch (c) {
+        case 'F':  return OP_FORWARD;
+        case '+':  return OP_TURN_LEFT;
+        case '-':  return OP_TURN_RIGHT;
+        case '&':  return OP_PITCH_DOWN;
+        case '^':  return OP_PITCH_UP;
+        case '/':  return OP_ROLL_LEFT;
+        case '\\': return OP_ROLL_RIGHT;
+        case '[':  return OP_PUSH;
+        case ']':  return OP_POP;
+        case '!':  return OP_WIDTH;
+        default:   return -1;
+    }
+}
+
+/*
+ * Lee el símbolo desc[*i] con su argumento y deja *i en el símbolo
+ * siguiente.  Devuelve false si el símbolo no tiene interpretación (X, A,
+ * etc.), en cuyo caso se descarta junto con su argumento.
+ */
+bool next_token(const char *desc, size_t size, size_t *i, Token *t) {
+    int op = opcode_of(desc[*i]);
+    double arg;
+    int jump;
+
+    get_argument(desc, size, *i, &arg, &jump);
+    *i += jump + 1;
+    if (op < 0)
+        return false;
+
+    t->op = (unsigned char)op;
+    t->has_arg = jump != 0;
+    t->arg = jump ? (float)arg : 0.0f;
+    return true;
+}
+
+/*
+ * Recorre la descripción una sola vez y la traduce a un arreglo de
+ * comandos de la tortuga.
+ */
+std::vector<Token> tokenize(const char *desc, size_t size) {
+    std::vector<Token> cmds;
+    Token t;
+
+    TRACE_SCOPE("tokenize");
+    cmds.reserve(size / 2);
+    for (size_t i = 0; i < size; )
+        if (next_token(desc, size, &i, &t))
+            cmds.push_back(t);
+    return cmds;
+}
+
+std::vector<Token> tokenize(const std::string &desc) {
+    return tokenize(desc.data(), desc.size());
+}
+
+/*
+ * Seno y coseno de un ángulo en grados.  Las descripciones repiten pocos
+ * ángulos distintos, así que se guardan en una tabla de acceso directo
+ * (una por hilo, para que turtle_step siga siendo reentrante).
+ */
+typedef struct {
+    double angle;
+    double s;
+    double c;
+    bool used;
+} SinCos;
+
+static inline const SinCos &sincos_deg(double angle) {
+    static thread_local SinCos cache[1 << TRIG_CACHE_BITS];
+    uint64_t bits;
+
+    memcpy(&bits, &angle, sizeof(bits));
+    SinCos &e = cache[(bits * 0x9E3779B97F4A7C15ull) >> (64 - TRIG_CACHE_BITS)];
+    if (!e.used || e.angle != angle) {
+        double alfa = (angle * PI)/180.0;
+        e.angle = angle;
+        e.s = sin(alfa);
+        e.c = cos(alfa);
+        e.used = true;
+    }
+    return e;
+}
+
+/*
+ * T = T*R para una rotación en torno a un eje de la tortuga.  R solo
+ * mezcla las columnas i y j de T, así que basta con actualizar esas seis
+ * entradas:
+ *   col_i = col_i*c + col_j*s
+ *   col_j = col_j*c - col_i*s
+ * Cuando las columnas son contiguas (Ru y Rh) cada fila es un par de
+ * doubles y se actualiza con una sola operación SSE2.
+ */
+static inline void rotate_cols(double T[DIM][DIM], int i, int j, double c, double s) {
+#ifdef __SSE2__
+    if (j == i + 1) {
+        const __m128d a = _mm_set_pd(-s, c);
+        const __m128d b = _mm_set_pd(c, s);
+        for (int r = 0; r < DIM; r++) {
+            __m128d v = _mm_loadu_pd(&T[r][i]);
+            __m128d x = _mm_unpacklo_pd(v, v);
+            __m128d y = _mm_unpackhi_pd(v, v);
+            _mm_storeu_pd(&T[r][i], _mm_add_pd(_mm_mul_pd(x, a), _mm_mul_pd(y, b)));
+        }
+        return;
+    }
+#endif
+    for (int r = 0; r < DIM; r++) {
+        double x = T[r][i];
+        double y = T[r][j];
+        T[r][i] = x*c + y*s;
+        T[r][j] = y*c - x*s;
+    }
+}
+
+/* T = T*Rz(angle): giro en torno a U */
+void rotate_U(double T[DIM][DIM], double angle) {
+    const SinCos &t = sincos_deg(angle);
+    rotate_cols(T, 0, 1, t.c, t.s);
+}
+
+/* T = T*Ry(angle): giro en torno a L */
+void rotate_L(double T[DIM][DIM], double angle) {
+    const SinCos &t = sincos_deg(angle);
+    rotate_cols(T, 0, 2, t.c, -t.s);
+}
+
+/* T = T*Rx(angle): giro en torno a H */
+void rotate_H(double T[DIM][DIM], double angle) {
+    const SinCos &t = sincos_deg(angle);
+    rotate_cols(T, 1, 2, t.c, t.s);
+}
+
+/*
+ * Fija el estado inicial de la tortuga en el punto P.
+ * Matriz para almacenar transformaciones a lo largo de iteraciones
+ * En un comienzo apunta hacia Y+, ya que la primera columna indica
+ * el Heading (hacia dónde apunta), la seguna cuál es la dirección 
+ * hacia la izquierda (en este caso hacia X+) y cual es la dirección
+ * hacia arriba (en este caso Z+). Cuando fue descrita por Lindenmayer
+ * et al en "The Algorithmic Beauty of Plants" esta matriz es mencionada
+ * como [H L U] (por Heading, Left, Up).
+ */
+void initial_state(State &S, double *P) {
+    double T[DIM][DIM] = {{0, 1, 0}, {1, 0, 0}, {0, 0, 1}};
+
+    assign_mat(S.T, T);
+    assign_vec(S.P, P);
+    S.width = DEFAULT_WIDTH;
+    S.color = 0.0;
+    S.parent = NO_PARENT;
+}
+
+LSystemInterpreter::LSystemInterpreter()
+    : langle(DEFAULT_ANGLE), lstep(DEFAULT_STEP), lwidth(DEFAULT_WIDTH) {
+    double P[DIM] = {0.0, 0.0, 0.0};
+
+    initial_state(EstadoActual, P);
+    PilaEstados.reserve(STACK_RESERVE);
+}
+
+void LSystemInterpreter::begin(double *P) {
+    initial_state(EstadoActual, P);
+    PilaEstados.clear();
+}
+
+bool LSystemInterpreter::turtle_step(State &S, std::vector<State> &pila, const Token &cmd,
+                                     SegmentStore &out, size_t i) const {
+    double arg = cmd.arg;
+    /* Vector para almacenar tamaño de segmento a dibujar */
+    double L[DIM] = {0, 0, 0};
+    /* Desplazamiento del segmento actual */
+    double D[DIM];
+
+    /* Los casos se describen en "L-systems: from the Theory to Visual Models of Plants"
+     * Apartado num. 5: The turtle interpretation of L-systems */
+    switch (cmd.op) {
+        case OP_FORWARD:
+            /* Si no hay argumento, entonces tomar valor por defecto */
+            if (!cmd.has_arg) arg = lstep;
+
+            /* Tamaño del segmento a dibujar */
+            L[0] = arg;
+            mat_by_vec(D, S.T, L);
+
+            out.set(i, S.P, S.T, S.width, arg, S.parent);
+            S.parent = (unsigned int)i;
+            sum_vec(S.P, D, S.P);
+            return true;
+        case OP_TURN_LEFT:
+            if (!cmd.has_arg) arg = langle;
+
+            //Ru
+            rotate_U(S.T, arg*-1.0);
+
+            if (DEBUG) printf("Rotar hacia izquierda en torno a eje U.  Ru(%f)\n", arg);
+            break;
+        case OP_TURN_RIGHT:
+            if (!cmd.has_arg) arg = langle;
+
+            //Ru
+            rotate_U(S.T, arg);
+
+            if (DEBUG) printf("Rotar hacia derecha en torno a eje U. Ru(-%f)\n", arg);
+            break;
+        case OP_PITCH_DOWN:
+            if (!cmd.has_arg) arg = langle;
+
+            //Rl
+            rotate_L(S.T, arg*-1.0);
+
+            if (DEBUG) printf("Rotar hacia izquierda en torno a eje L. Rl(%f)\n", arg);
+            break;
+        case OP_PITCH_UP:
+            if (!cmd.has_arg) arg = langle;
+
+            //Rl
+            rotate_L(S.T, arg);
+
+            if (DEBUG) printf("Rotar hacia derecha en torno a eje L. Rl(-%f)\n", arg);
+            break;
+        case OP_ROLL_LEFT:
+            if (!cmd.has_arg) arg = langle;
+
+            //Rh
+            rotate_H(S.T, arg*-1.0);
+
+            if (DEBUG) printf("Rotar hacia izquierda en torno a eje H. Rh(%f)\n", arg);
+            break;
+        case OP_ROLL_RIGHT:
+            if (!cmd.has_arg) arg = langle;
+
+            //Rh
+            rotate_H(S.T, arg);
+
+            if (DEBUG) printf("Rotar hacia derecha en torno a eje H. Rh(-%f)\n", arg);
+            break;
+        case OP_PUSH:
+            /* Guardar el estado actual en la pila */
+            pila.push_back(S);
+
+            if (DEBUG) printf("Guardar el estado actual en la pila.\n");
+            break;
+        case OP_POP:
+            /* Sacar el estado desde la pila y actualizarlo como estado actual */
+            if (!pila.empty()) {
+                S = pila.back();
+                pila.pop_back();
+            }
+
+            if (DEBUG) printf("Obtener estado desde la pila y actualizarlo como estado actual.\n");
+            break;
+        case OP_WIDTH:
+            if (!cmd.has_arg) arg = lwidth;
+
+            S.width = arg;
+            break;
+        default:
+            break;
+    }
+    return false;
+}
+
+void LSystemInterpreter::exec(const Token &cmd) {
+    size_t i = lines.size();
+
+    if (cmd.op == OP_FORWARD)
+        lines.resize(i + 1);
+    turtle_step(EstadoActual, PilaEstados, cmd, lines, i);
+}
+
+void LSystemInterpreter::read_desc(const Token *cmds, size_t n, double *P) {
+    size_t segments = 0;
+
+    TRACE_SCOPE("read_desc");
+    begin(P);
+
+    /* Reservar de una vez el espacio para todos los segmentos */
+    for (size_t i = 0; i < n; i++)
+        if (cmds[i].op == OP_FORWARD) segments++;
+    lines.reserve(lines.size() + segments);
+
+    for (size_t i = 0; i < n; i++)
+        exec(cmds[i]);
+}
+
+void LSystemInterpreter::read_desc(const std::vector<Token> &cmds, double *P) {
+    read_desc(cmds.data(), cmds.size(), P);
+}
+
+/*
+ * Interpreta la descripción directamente sobre sus bytes (por ejemplo, un
+ * archivo proyectado con mmap), sin guardar los comandos.
+ */
+void LSystemInterpreter::read_desc(const char *desc, size_t size, double *P) {
+    Token t;
+
+    TRACE_SCOPE("read_desc");
+    begin(P);
+    lines.reserve(lines.size() + std::count(desc, desc + size, 'F'));
+    for (size_t i = 0; i < size; )
+        if (next_token(desc, size, &i, &t))
+            exec(t);
+}
+
+void LSystemInterpreter::read_desc(const std::string &desc, double *P) {
+    read_desc(desc.data(), desc.size(), P);
+}
+
+/*
+ * Lee un archivo con el formato de data/N.txt: una línea con el tamaño
+ * del paso, otra con el ángulo y luego la descripción del L-system.
+ */
+bool load_desc_file(const char *path, double *step, double *angle, std::string *desc) {
+    DescFile f;
+
+    if (!f.open(path))
+        return false;
+    *step = f.step;
+    *angle = f.angle;
+    desc->assign(f.desc, f.size);
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+/**
+ * L-systems: intérprete de tortuga (sin dependencias de OpenGL/GLUT).
+ * Basado en el libro de A. Lindenmayer "The Algorithmic Beauty of Plants"
+ */
+#ifndef LSYSTEM_H
+#define LSYSTEM_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "segments.h"
+
+#define PI              3.14159265
+#define DEBUG           0
+#define DIM             3
+#define DEFAULT_STEP    1
+#define DEFAULT_ANGLE   45
+#define DEFAULT_WIDTH	5.0
+
+/*
+ * Estructura para guardar estado actual del L-system.
+ * Esta estructura consiste en:
+ * T: matriz de transformación actual
+ * P: punto actual
+ * parent: último segmento dibujado en la rama actual o en las que la
+ *         contienen (NO_PARENT si todavía no hay ninguno)
+ */
+
+typedef struct {
+    double T[DIM][DIM];
+    double P[DIM];
+    double width;
+    double color;
+    unsigned int parent;
+} State;
+
+typedef struct {
+	double P0[DIM];
+	double P1[DIM];
+	double width;
+	double size;
+	double color;
+	double T[16];
+} LineSegment;
+
+/*
+ * Operaciones de la tortuga.  Cada símbolo de la descripción que tiene
+ * interpretación se traduce a uno de estos códigos; el resto se descarta
+ * al tokenizar.
+ */
+enum Opcode : unsigned char {
+    OP_FORWARD,     /* F  */
+    OP_TURN_LEFT,   /* +  */
+    OP_TURN_RIGHT,  /* -  */
+    OP_PITCH_DOWN,  /* &  */
+    OP_PITCH_UP,    /* ^  */
+    OP_ROLL_LEFT,   /* /  */
+    OP_ROLL_RIGHT,  /* \  */
+    OP_PUSH,        /* [  */
+    OP_POP,         /* ]  */
+    OP_WIDTH        /* !  */
+};
+
+/* Comando de la tortuga ya tokenizado: operación y argumento opcional. */
+typedef struct {
+    unsigned char op;
+    bool has_arg;
+    float arg;
+} Token;
+
+/*
+ * Intérprete de tortuga.  Cada instancia tiene su propio estado, pila,
+ * parámetros y segmentos, así que se pueden generar varios árboles a la
+ * vez en hilos distintos.
+ */
+class LSystemInterpreter {
+public:
+    LSystemInterpreter();
+
+    /* Fija el estado inicial en P y vacía la pila (no los segmentos) */
+    void begin(double *P);
+    /* Ejecuta un comando sobre el estado actual, agregando a 'lines' lo dibujado */
+    void exec(const Token &cmd);
+    /*
+     * Ejecuta un comando sobre el estado S y su pila.  Si el comando dibuja
+     * un segmento, lo escribe en la posición i de 'out' (que ya debe existir)
+     * y devuelve true.  Solo lee los parámetros del intérprete.
+     */
+    bool turtle_step(State &S, std::vector<State> &pila, const Token &cmd,
+                     SegmentStore &out, size_t i) const;
+
+    void read_desc(const Token *cmds, size_t n, double *P);
+    void read_desc(const std::vector<Token> &cmds, double *P);
+    void read_desc(const char *desc, size_t size, double *P);
+    void read_desc(const std::string &desc, double *P);
+
+    /* Valores de los comandos sin argumento */
+    double langle;
+    double lstep;
+    double lwidth;
+
+    State EstadoActual;
+    /* Pila para guardar estado actual al iniciar una nueva 'rama' (branch) */
+    std::vector<State> PilaEstados;
+    SegmentStore lines;
+};
+
+/* Operaciones sobre matrices */
+void mat_by_mat(double result[DIM][DIM], double A[DIM][DIM], double B[DIM][DIM]);
+void assign_mat(double result[DIM][DIM], double M[DIM][DIM]);
+void assign_vec(double result[DIM], double A[DIM]);
+void print_mat(double M[DIM][DIM]);
+void print_vec(double A[DIM]);
+void mat_by_vec(double result[DIM], double M[DIM][DIM], double V[DIM]);
+void sum_vec(double result[DIM], double A[DIM], double B[DIM]);
+
+/* Matrices de transformación */
+void Ru_matrix(double R[DIM][DIM], double angle);
+void Rz_matrix(double R[DIM][DIM], double angle);
+void Rl_matrix(double R[DIM][DIM], double angle);
+void Ry_matrix(double R[DIM][DIM], double angle);
+void Rh_matrix(double R[DIM][DIM], double angle);
+void Rx_matrix(double R[DIM][DIM], double angle);
+void assign_GL_mat(LineSegment *LS, double M[DIM][DIM]);
+
+/* Rotaciones de la tortuga aplicadas en el lugar: T = T*R(angle) */
+void rotate_U(double T[DIM][DIM], double angle);
+void rotate_L(double T[DIM][DIM], double angle);
+void rotate_H(double T[DIM][DIM], double angle);
+
+/* Lectura e interpretación de la descripción */
+void get_argument(const char *desc, size_t size, size_t start, double *arg, int *jump);
+int opcode_of(char c);
+bool next_token(const char *desc, size_t size, size_t *i, Token *t);
+std::vector<Token> tokenize(const char *desc, size_t size);
+std::vector<Token> tokenize(const std::string &desc);
+void initial_state(State &S, double *P);
+
+/*
+ * Lectura de archivos en el formato de data/N.txt: paso, ángulo y
+ * descripción.  Copia la descripción; DescFile (loader.h) la deja en el
+ * archivo proyectado.
+ */
+bool load_desc_file(const char *path, double *step, double *angle, std::string *desc);
+
+#endif
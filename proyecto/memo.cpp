@@ -0,0 +1,248 @@
+/**
+ * L-systems: derivación con caché de subárboles.
+ */
+#include <cmath>
+#include <cstring>
+#include "memo.h"
+#include "trace.h"
+
+size_t MemoKeyHash::operator()(const MemoKey &k) const {
+    uint64_t h = splitmix64((uint64_t)(unsigned char)k.sym << 40 |
+                            (uint64_t)k.nparams << 32 | (uint32_t)k.level);
+    for (unsigned int i = 0; i < k.nparams; i++) {
+        uint64_t bits;
+        memcpy(&bits, &k.args[i], sizeof(bits));
+        h = splitmix64(h ^ bits);
+    }
+    return (size_t)h;
+}
+
+/* Los parámetros se comparan bit a bit, igual que en el hash */
+bool MemoKeyEqual::operator()(const MemoKey &a, const MemoKey &b) const {
+    return a.sym == b.sym && a.nparams == b.nparams && a.level == b.level &&
+           memcmp(a.args, b.args, a.nparams * sizeof(double)) == 0;
+}
+
+MemoDerivation::MemoDerivation() : grammar(NULL), lstep(0), langle(0), lwidth(0) {
+    memset(&stats, 0, sizeof(stats));
+}
+
+void MemoDerivation::clear() {
+    entries.clear();
+    pieces.clear();
+    index.clear();
+    grammar = NULL;
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool MemoDerivation::cacheable(const LSystem &g) {
+    if (g.stochastic || g.context_sensitive)
+        return false;
+    for (const Production &p : g.productions) {
+        int depth = 0;
+        for (unsigned int k = p.succ_begin; k < p.succ_end; k++) {
+            char c = g.successors[k].sym;
+            if (c == '[') depth++;
+            else if (c == ']' && --depth < 0) return false;
+        }
+        if (depth != 0) return false;
+    }
+    return true;
+}
+
+/*
+ * Aplica el estado local 'l' (relativo a S) a S: S.P += S.T*l.P,
+ * S.T = S.T*l.T y hereda el grosor y el padre si 'l' no los fija.  'base'
+ * es la posición del primer segmento de la entrada de 'l'.
+ */
+static void compose(State &S, const MemoPiece &l, size_t base) {
+    double P[DIM], T[DIM][DIM];
+
+    for (int r = 0; r < DIM; r++) {
+        P[r] = S.P[r];
+        for (int c = 0; c < DIM; c++) {
+            P[r] += S.T[r][c] * l.P[c];
+            T[r][c] = 0;
+            for (int k = 0; k < DIM; k++)
+                T[r][c] += S.T[r][k] * l.T[k][c];
+        }
+    }
+    assign_vec(S.P, P);
+    assign_mat(S.T, T);
+    if (!std::isnan(l.width))
+        S.width = l.width;
+    if (l.parent != NO_PARENT)
+        S.parent = (unsigned int)(base + l.parent);
+}
+
+static void piece_from_state(MemoPiece &m, const State &L, int entry) {
+    memcpy(m.P, L.P, sizeof(m.P));
+    memcpy(m.T, L.T, sizeof(m.T));
+    m.width = L.width;
+    m.length = 0.0;
+    m.parent = L.parent;
+    m.entry = entry;
+}
+
+/*
+ * Entrada del módulo (sym, args) con 'level' generaciones por delante, cuya
+ * producción es p.  Los módulos del sucesor que todavía se expanden se
+ * construyen primero (recursión de a lo más 'level' niveles); luego el
+ * sucesor se interpreta con una tortuga local en la que cada uno de ellos
+ * es un solo paso.
+ */
+int MemoDerivation::build(const LSystem &g, const LSystemInterpreter &tortuga,
+                          const Production *p, char sym, unsigned char nparams,
+                          const double *args, int level) {
+    MemoKey key;
+    memset(&key, 0, sizeof(key));
+    key.sym = sym;
+    key.nparams = nparams;
+    key.level = level;
+    memcpy(key.args, args, nparams * sizeof(double));
+
+    stats.lookups++;
+    auto it = index.find(key);
+    if (it != index.end()) {
+        stats.hits++;
+        return it->second;
+    }
+
+    std::vector<MemoPiece> local;
+    std::vector<State> pila;
+    SegmentStore none;
+    double a[MAX_PARAMS];
+    size_t count = 0;
+    State L;
+    double origin[DIM] = {0, 0, 0};
+
+    initial_state(L, origin);
+    for (int r = 0; r < DIM; r++)
+        for (int c = 0; c < DIM; c++)
+            L.T[r][c] = r == c;
+    L.width = NAN;
+
+    for (unsigned int k = p->succ_begin; k < p->succ_end; k++) {
+        const SuccModule &sm = g.successors[k];
+        for (unsigned int j = 0; j < sm.nparams; j++)
+            a[j] = g.eval(g.exprs[sm.expr + j], args);
+
+        const Production *cp = level > 1 ? g.match(sm.sym, sm.nparams, a) : NULL;
+        if (cp) {
+            int c = build(g, tortuga, cp, sm.sym, sm.nparams, a, level - 1);
+            MemoPiece m;
+            piece_from_state(m, L, c);
+            local.push_back(m);
+
+            MemoPiece exit = entries[c].exit;
+            compose(L, exit, count);
+            count += entries[c].count;
+            continue;
+        }
+
+        /* Terminal: el mismo comando que entregaría stream_derive */
+        int op = opcode_of(sm.sym);
+        if (op < 0) continue;
+        Token t;
+        t.op = (unsigned char)op;
+        t.has_arg = sm.nparams > 0;
+        t.arg = sm.nparams ? (float)a[0] : 0.0f;
+
+        if (t.op == OP_FORWARD) {
+            double len = t.has_arg ? t.arg : tortuga.lstep;
+            MemoPiece m;
+            piece_from_state(m, L, -1);
+            m.length = len;
+            local.push_back(m);
+            for (int r = 0; r < DIM; r++)
+                L.P[r] += L.T[r][0] * len;
+            L.parent = (unsigned int)count++;
+        }
+        else
+            tortuga.turtle_step(L, pila, t, none, 0);
+    }
+
+    MemoEntry e;
+    e.first = (unsigned int)pieces.size();
+    e.pieces = (unsigned int)local.size();
+    e.count = count;
+    piece_from_state(e.exit, L, -1);
+    pieces.insert(pieces.end(), local.begin(), local.end());
+    entries.push_back(e);
+
+    int id = (int)entries.size() - 1;
+    index.emplace(key, id);
+    return id;
+}
+
+/* Escribe los segmentos de la entrada e, que entra con el estado S, desde out[base] */
+void MemoDerivation::instance(int e, const State &S, SegmentStore &out, size_t base) const {
+    const MemoEntry &entry = entries[e];
+    size_t k = base;
+
+    for (unsigned int i = entry.first; i < entry.first + entry.pieces; i++) {
+        const MemoPiece &m = pieces[i];
+        State W = S;
+        compose(W, m, base);
+
+        if (m.entry < 0) {
+            out.set(k, W.P, W.T, W.width, m.length, W.parent);
+            k++;
+        }
+        else {
+            instance(m.entry, W, out, k);
+            k += entries[m.entry].count;
+        }
+    }
+}
+
+bool MemoDerivation::run(const LSystem &g, int n, LSystemInterpreter &tortuga, double *P,
+                         uint64_t seed) {
+    TRACE_SCOPE("memo_derivation");
+    if (!cacheable(g)) {
+        stream_derive(g, n, tortuga, P, seed);
+        return false;
+    }
+    if (grammar != &g || lstep != tortuga.lstep || langle != tortuga.langle ||
+        lwidth != tortuga.lwidth) {
+        clear();
+        grammar = &g;
+        lstep = tortuga.lstep;
+        langle = tortuga.langle;
+        lwidth = tortuga.lwidth;
+    }
+
+    stats.lookups = stats.hits = 0;
+    tortuga.begin(P);
+    for (const Module &m : g.axiom.modules) {
+        const double *args = g.axiom.params.data() + m.param;
+        const Production *p = n > 0 ? g.match(m.sym, m.nparams, args) : NULL;
+
+        if (p) {
+            int e = build(g, tortuga, p, m.sym, m.nparams, args, n);
+            SegmentStore &lines = tortuga.lines;
+            size_t base = lines.size();
+
+            lines.resize(base + entries[e].count);
+            instance(e, tortuga.EstadoActual, lines, base);
+            compose(tortuga.EstadoActual, entries[e].exit, base);
+            continue;
+        }
+
+        int op = opcode_of(m.sym);
+        if (op < 0) continue;
+        Token t;
+        t.op = (unsigned char)op;
+        t.has_arg = m.nparams > 0;
+        t.arg = m.nparams ? (float)args[0] : 0.0f;
+        tortuga.exec(t);
+    }
+
+    stats.entries = entries.size();
+    stats.pieces = pieces.size();
+    stats.bytes = entries.capacity() * sizeof(MemoEntry) +
+                  pieces.capacity() * sizeof(MemoPiece) +
+                  index.size() * (sizeof(MemoKey) + sizeof(int) + 2 * sizeof(void *)) +
+                  index.bucket_count() * sizeof(void *);
+    return true;
+}
@@ -0,0 +1,107 @@
+/**
+ * L-systems: derivación con caché de subárboles.
+ *
+ * Cada módulo (símbolo, parámetros, generaciones restantes) de una
+ * gramática determinista se deriva una sola vez; su geometría se guarda
+ * en el espacio local de la tortuga y se reutiliza transformada.
+ */
+#ifndef MEMO_H
+#define MEMO_H
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+#include "lsystem.h"
+#include "rewrite.h"
+
+/*
+ * Segmento o instancia en el espacio local de una entrada.  Un grosor NAN
+ * es el de entrada; un padre NO_PARENT es el padre de entrada.
+ */
+typedef struct {
+    double P[DIM];
+    double T[DIM][DIM];
+    double width;
+    double length;          /* largo del segmento */
+    unsigned int parent;    /* segmento padre, numerado dentro de la entrada */
+    int entry;              /* entrada instanciada, o -1 si es un segmento */
+} MemoPiece;
+
+/*
+ * Entrada de la caché: piezas en orden, los segmentos de los 'F'
+ * terminales del sucesor y las instancias de las entradas de los módulos
+ * que todavía se expanden.  El árbol completo es un grafo acíclico de
+ * entradas.
+ */
+typedef struct {
+    unsigned int first;     /* piezas [first, first + pieces) */
+    unsigned int pieces;
+    size_t count;           /* segmentos de la entrada completa */
+    MemoPiece exit;         /* estado local de la tortuga al salir */
+} MemoEntry;
+
+typedef struct {
+    char sym;
+    unsigned char nparams;
+    int level;                  /* generaciones restantes */
+    double args[MAX_PARAMS];    /* los que sobran van en cero */
+} MemoKey;
+
+struct MemoKeyHash {
+    size_t operator()(const MemoKey &k) const;
+};
+
+struct MemoKeyEqual {
+    bool operator()(const MemoKey &a, const MemoKey &b) const;
+};
+
+/* Búsquedas y aciertos de la última llamada a run(); el resto, de toda la caché */
+typedef struct {
+    size_t lookups;         /* módulos no terminales buscados en la caché */
+    size_t hits;
+    size_t entries;
+    size_t pieces;
+    size_t bytes;           /* memoria de la caché (aproximada) */
+} MemoStats;
+
+class MemoDerivation {
+public:
+    MemoDerivation();
+
+    /*
+     * Igual que stream_derive: deja en tortuga.lines los segmentos de 'n'
+     * generaciones.  Un módulo al que le quedan k generaciones siempre se
+     * expande a la misma cadena, que la tortuga dibuja igual salvo por el
+     * estado con que entra (posición, orientación, grosor y padre); por eso
+     * cada entrada se construye entrando en el origen con T = I, y generar
+     * los segmentos es recorrer el grafo componiendo transformaciones, sin
+     * volver a evaluar producciones.
+     *
+     * Solo se memorizan gramáticas deterministas, sin contextos y con los
+     * corchetes de cada sucesor balanceados (cacheable()); con las demás
+     * se usa stream_derive (con 'seed') y se devuelve false.
+     *
+     * La caché se conserva entre llamadas con la misma gramática (el mismo
+     * objeto, que debe seguir vivo y sin modificar) y los mismos
+     * parámetros de la tortuga; si cambian, se vacía.
+     */
+    bool run(const LSystem &g, int n, LSystemInterpreter &tortuga, double *P,
+             uint64_t seed = 0);
+    void clear();
+    static bool cacheable(const LSystem &g);
+
+    MemoStats stats;
+
+private:
+    int build(const LSystem &g, const LSystemInterpreter &tortuga, const Production *p,
+              char sym, unsigned char nparams, const double *args, int level);
+    void instance(int e, const State &S, SegmentStore &out, size_t base) const;
+
+    const LSystem *grammar;
+    double lstep, langle, lwidth;
+    std::vector<MemoEntry> entries;
+    std::vector<MemoPiece> pieces;
+    std::unordered_map<MemoKey, int, MemoKeyHash, MemoKeyEqual> index;
+};
+
+#endif
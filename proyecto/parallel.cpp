@@ -0,0 +1,142 @@
+/**
+ * L-systems: interpretación paralela de la descripción.
+ *
+ * Una rama '[...]' bien formada deja el estado de la tortuga igual que
+ * estaba al entrar, así que cada rama se puede interpretar por separado
+ * si se conoce el estado en su '['.  Una pasada secuencial recorre el
+ * "tronco" de la descripción, anota el estado de entrada de cada rama
+ * mediana y la salta; luego los hilos interpretan esas ramas.
+ *
+ * El segmento del i-ésimo 'F' de la descripción siempre queda en la
+ * posición i de la salida, por lo que cada rama escribe directamente en
+ * su tramo de tortuga.lines y no hace falta concatenar ni reordenar.
+ *
+ * En un bosque cada árbol es una tarea: la semilla de cada uno depende
+ * solo de su número, no del hilo que lo deriva.
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include "parallel.h"
+#include "trace.h"
+
+typedef struct {
+    size_t begin;       /* índice del '[' */
+    size_t end;         /* índice siguiente al ']' */
+    State S;            /* estado de la tortuga en el '[' */
+} BranchTask;
+
+void read_desc_parallel(LSystemInterpreter &tortuga, const Token *cmds, size_t n,
+                        double *P, unsigned threads) {
+    SegmentStore &lines = tortuga.lines;
+    size_t base = lines.size();
+
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    if (threads == 1 || n >= UINT32_MAX) {
+        tortuga.read_desc(cmds, n, P);
+        return;
+    }
+    TRACE_SCOPE("read_desc_parallel");
+
+    /* Paréntesis correspondientes y cantidad de 'F' antes de cada comando */
+    std::vector<uint32_t> match(n), before(n + 1);
+    std::vector<uint32_t> open;
+    before[0] = 0;
+    for (size_t i = 0; i < n; i++) {
+        before[i + 1] = before[i] + (cmds[i].op == OP_FORWARD);
+        if (cmds[i].op == OP_PUSH) {
+            match[i] = i;       /* sin cerrar mientras no se encuentre ']' */
+            open.push_back(i);
+        }
+        else if (cmds[i].op == OP_POP && !open.empty()) {
+            match[open.back()] = i;
+            open.pop_back();
+        }
+    }
+    lines.resize(base + before[n]);
+
+    /*
+     * Pasada por el tronco.  Las ramas de tamaño entre grain/8 y grain son
+     * tareas; las más grandes se recorren para dividirlas más abajo y las
+     * más chicas se interpretan aquí mismo.
+     */
+    size_t grain = std::max<size_t>(n / (threads * 32), 1024);
+    std::vector<BranchTask> tasks;
+
+    /* El tronco usa el estado de la tortuga y queda en él, como en read_desc */
+    tortuga.begin(P);
+    State &S = tortuga.EstadoActual;
+    std::vector<State> &pila = tortuga.PilaEstados;
+    for (size_t i = 0; i < n; ) {
+        if (cmds[i].op == OP_PUSH && match[i] > i) {
+            size_t len = match[i] + 1 - i;
+            if (len >= grain / 8 && len < grain) {
+                BranchTask t = {i, (size_t)match[i] + 1, S};
+                tasks.push_back(t);
+                i = match[i] + 1;
+                continue;
+            }
+        }
+        tortuga.turtle_step(S, pila, cmds[i], lines, base + before[i]);
+        i++;
+    }
+
+    /* Las tareas más largas primero, para repartir mejor la carga */
+    std::sort(tasks.begin(), tasks.end(), [](const BranchTask &a, const BranchTask &b) {
+        return a.end - a.begin > b.end - b.begin;
+    });
+
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        std::vector<State> pila;
+        for (size_t k; (k = next++) < tasks.size(); ) {
+            State S = tasks[k].S;
+            size_t out = base + before[tasks[k].begin];
+            for (size_t i = tasks[k].begin; i < tasks[k].end; i++)
+                if (tortuga.turtle_step(S, pila, cmds[i], lines, out))
+                    out++;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; t++)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread &t : pool)
+        t.join();
+}
+
+void read_desc_parallel(LSystemInterpreter &tortuga, const std::vector<Token> &cmds,
+                        double *P, unsigned threads) {
+    read_desc_parallel(tortuga, cmds.data(), cmds.size(), P, threads);
+}
+
+void derive_forest(const LSystem &g, int n, const LSystemInterpreter &tortuga, double *P,
+                   uint64_t seed, size_t trees, std::vector<SegmentStore> &forest,
+                   unsigned threads) {
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    forest.resize(trees);
+
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        LSystemInterpreter local;
+        local.lstep = tortuga.lstep;
+        local.langle = tortuga.langle;
+        local.lwidth = tortuga.lwidth;
+        for (size_t k; (k = next++) < trees; ) {
+            local.lines.clear();
+            stream_derive(g, n, local, P, seed + k);
+            forest[k] = local.lines;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads && t < trees; t++)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread &t : pool)
+        t.join();
+}
@@ -0,0 +1,36 @@
+/**
+ * L-systems: interpretación paralela de la descripción y derivación
+ * paralela de bosques.
+ */
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <cstdint>
+#include <vector>
+#include "lsystem.h"
+#include "rewrite.h"
+
+/*
+ * Interpreta los comandos igual que tortuga.read_desc, repartiendo las
+ * ramas '[...]' entre 'threads' hilos.  Los segmentos agregados a
+ * tortuga.lines son idénticos (bit a bit) y están en el mismo orden que
+ * los de read_desc, y la tortuga queda en el mismo estado final.  Con
+ * threads == 0 se usa un hilo por núcleo.
+ */
+void read_desc_parallel(LSystemInterpreter &tortuga, const Token *cmds, size_t n,
+                        double *P, unsigned threads);
+void read_desc_parallel(LSystemInterpreter &tortuga, const std::vector<Token> &cmds,
+                        double *P, unsigned threads);
+
+/*
+ * Deriva e interpreta 'trees' árboles de la gramática g con 'n'
+ * generaciones; el árbol k usa la semilla seed + k y sus segmentos quedan
+ * en forest[k].  Los árboles se reparten entre 'threads' hilos (0: uno
+ * por núcleo), cada uno con su propio intérprete con los parámetros de
+ * 'tortuga'.  El bosque es el mismo con cualquier número de hilos.
+ */
+void derive_forest(const LSystem &g, int n, const LSystemInterpreter &tortuga, double *P,
+                   uint64_t seed, size_t trees, std::vector<SegmentStore> &forest,
+                   unsigned threads);
+
+#endif
@@ -0,0 +1,54 @@
+/**
+ * Gramáticas de los árboles predefinidos del menú.
+ * Árboles binarios de Honda, "The Algorithmic Beauty of Plants", fig. 2.8,
+ * con los parámetros que generan data/dol_a.txt y data/dol_g.txt, y una
+ * variante estocástica para generar árboles distintos con cada semilla.
+ */
+#ifndef PRESETS_H
+#define PRESETS_H
+
+static const char *PRESET_ARBOL_A = R"(
+#define r1 0.75             /* razón de contracción del tronco */
+#define r2 0.77             /* razón de contracción de las ramas */
+#define a1 35               /* ángulo de ramificación 1 */
+#define a2 -35              /* ángulo de ramificación 2 */
+#define d1 0                /* ángulo de divergencia 1 */
+#define d2 0                /* ángulo de divergencia 2 */
+#define wr 0.757858283255   /* razón de decrecimiento del grosor */
+n: 11
+w: A(5,30)
+p1: A(l,w) : * -> !(w)F(l)[+(a1)/(d1)A(l*r1,w*wr)][+(a2)/(d2)A(l*r2,w*wr)]
+)";
+
+static const char *PRESET_ARBOL_G = R"(
+#define r1 0.8
+#define r2 0.8
+#define a1 30
+#define a2 -30
+#define d1 137
+#define d2 137
+#define wr 0.707106781187
+n: 11
+w: A(5,30)
+p1: A(l,w) : * -> !(w)F(l)[+(a1)/(d1)A(l*r1,w*wr)][+(a2)/(d2)A(l*r2,w*wr)]
+)";
+
+/*
+ * Honda estocástico: a veces una sola rama lateral, a veces un entrenudo
+ * corto sin ramas.  La divergencia es el ángulo áureo.
+ */
+static const char *PRESET_ARBOL_S = R"(
+#define r1 0.8
+#define r2 0.72
+#define a1 32
+#define a2 -38
+#define d 137.5
+#define wr 0.72
+n: 11
+w: A(5,30)
+p1: A(l,w) : * -> !(w)F(l)[+(a1)/(d)A(l*r1,w*wr)][+(a2)/(d)A(l*r2,w*wr)] : 0.55
+p2: A(l,w) : * -> !(w)F(l)[+(a2)/(d)A(l*r2,w*wr)]/(d)A(l*r1,w*wr) : 0.25
+p3: A(l,w) : * -> !(w)F(l*0.6)/(d)A(l*r1,w*wr) : 0.2
+)";
+
+#endif
@@ -3,127 +3,268 @@
  * Basado en el libro de A. Lindenmayer "The Algorithmic Beauty of Plants"
  *
  * Para compilar: make
- * Para ejecutar: ./proyecto < data/[0-8].txt
+ * Para ejecutar: ./proyecto data/[0-9].txt   o   ./proyecto < data/[0-9].txt
+ * También acepta descripciones precompiladas (make lsb): data/[0-9].lsb
+ * Sin archivo se parte con la pantalla vacía y los árboles del menú.
+ *
+ * Medición de cuadros por segundo (dibuja N cuadros girando la cámara):
+ *   ./proyecto --fps N [--legacy] [--lod L] [--nocull] [--distance D] [data/dol_a.txt]
+ * Sin archivo ni entrada redirigida se usa el árbol A.  --legacy dibuja
+ * sin instancing, --lod fija el nivel de detalle (0 a 5; por omisión
+ * depende del tamaño), --nocull dibuja también los segmentos fuera de la
+ * vista y --distance acerca o aleja la cámara (15 por omisión; en la
+ * ventana, con '+' y '-').
+ *
+ * Sin ventana (EGL, sirve sin pantalla ni GPU), N cuadros de una vuelta
+ * completa de la cámara, con el tiempo de CPU y total y los segmentos
+ * visibles de cada cuadro (acepta las mismas opciones que --fps):
+ *   ./proyecto --headless N [--size 500x500] [--out cuadro_] [data/dol_a.txt]
+ * Con --out se guarda cada cuadro como cuadro_NNNN.ppm.
+ *
+ * Con --shapes (en --fps, --headless o la ventana) los subárboles que se
+ * repiten salvo escala se suben una sola vez y se dibujan como instancias
+ * (subtree.h), sin guardar los segmentos planos; si así no se ahorra
+ * memoria se dibujan los planos.  --headless informa la memoria residente.
+ *
+ * Con --threads N los archivos se interpretan repartiendo las ramas entre
+ * N hilos (0: uno por núcleo; parallel.h); el árbol es el mismo.
+ *
+ * Exportar el árbol a una malla para otro programa (PLY o glTF binario):
+ *   ./proyecto --export arbol.glb [--slices 12] [data/dol_a.txt]
+ *
+ * Compilado con make proyecto_trace (trace.h), guarda los tiempos de cada
+ * etapa y los contadores de cada cuadro en trace.json, o en el archivo de
+ * --trace archivo.json.
  */
 #include <iostream>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <cmath>
-#include <stack>
 #include <vector>
-#include <array>
+#include <chrono>
+#include <ctime>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <GL/glew.h>
 #include <GL/freeglut.h>
+#include "lsystem.h"
+#include "rewrite.h"
+#include "presets.h"
+#include "render.h"
+#include "headless.h"
+#include "loader.h"
+#include "lsb.h"
+#include "export.h"
+#include "memo.h"
+#include "parallel.h"
+#include "subtree.h"
+#include "trace.h"
 
-#define PI              3.14159265
 #define ESC             27
-#define DEBUG           0
-#define DIM             3
-#define MAX_DESC        120000
-#define DEFAULT_STEP    1
-#define DEFAULT_ANGLE   45
-#define DEFAULT_WIDTH	5.0
 
 #define SALIR           0
 #define ARBOL_A         1
+#define ARBOL_S         2
 #define ARBOL_G         7
 #define FRACTAL_A       10
 
-
-/* 
- * Estructura para guardar estado actual del L-system.
- * Esta estructura consiste en:
- * T: matriz de transformación actual
- * P: punto actual
- */
- 
-typedef struct {
-    double T[DIM][DIM];
-    double P[DIM];
-    double width;
-    double color;
-} State;
-
-typedef struct {
-	double P0[DIM];
-	double P1[DIM];
-	double width;
-	double size;
-	double color;
-	GLdouble T[16];
-} LineSegment;
-
-State EstadoActual;
-
-/* Pila para guardar estado actual al iniciar una nueva 'rama' (branch) */
-std::stack<State> PilaEstados;
-//std::vector<std::pair<std::array<double, 3>, std::array<double, 3>>> lines;
-std::vector<LineSegment> lines;
-
 float XAngle = 0.0;
 float YAngle = 0.0;
+/* Distancia horizontal de la cámara al eje de giro ('+' y '-' la cambian) */
+float distance = 15.0;
 
-/* Descripción textual del L-system */
-std::string lsystem_desc;
-double langle = DEFAULT_ANGLE;
-double lstep = DEFAULT_STEP;
-double lwidth 	= DEFAULT_WIDTH;
+/* Intérprete que genera los segmentos del árbol mostrado */
+LSystemInterpreter tortuga;
+
+/* Dibujo de los segmentos en la GPU */
+TreeRenderer renderer;
 
 /* Punto inicial */
 double P[DIM] = {0.0, 2.0, 0.0};
 
+/*
+ * Gramática y caché de subárboles de cada árbol del menú.  Se conservan
+ * entre regeneraciones: la caché reconoce la gramática por su dirección,
+ * así que cada árbol tiene su propio LSystem, que no se vuelve a leer.
+ */
+struct PresetTree {
+    bool parsed = false;
+    LSystem grammar;
+    MemoDerivation memo;
+};
+static PresetTree preset_trees[ARBOL_G + 1];
+/* Estadísticas de la caché del árbol mostrado, o NULL si no se usó */
+static const MemoStats *memo_stats = NULL;
+
+/* Hilos para interpretar los archivos (--threads; 0: uno por núcleo) */
+static unsigned load_threads = 1;
+
+/* Modo --shapes: corte que se dibuja en lugar de tortuga.lines */
+static bool use_shapes = false;
+static SubtreeLayout layout;
+
+/* Resumen del último build_shapes; las formas ya no están en memoria */
+typedef struct {
+    size_t groups;
+    size_t shapes;
+    size_t shape_bytes;
+    size_t segments;        /* del árbol expandido */
+    size_t flat_bytes;      /* que ocuparían en tortuga.lines */
+    size_t threshold;
+    size_t instances;
+    size_t layout_bytes;
+    bool drawn;             /* se dibuja el corte y tortuga.lines está vacío */
+} ShapeInfo;
+static ShapeInfo shape_info;
+
 static int window;
 static int menu_value = 0;
+static GLuint floor_list;
+static size_t floor_triangles;
+static GLUquadricObj *light_quadric;
+
+/* Modo --fps: cuadros a medir, cuadros dibujados e inicio de la medición */
+static int fps_frames = 0;
+static int fps_count = 0;
+static std::chrono::steady_clock::time_point fps_start;
 
 void drawScene();
+void render_scene();
+void fps_frame();
+void build_floor();
+void fps_idle();
+bool stdin_redirected();
+bool load_tree(const char *path);
+bool load_default_tree(const char *path);
+void build_shapes(const Token *cmds, size_t n);
+size_t tree_segments();
+void print_memo_stats(const char *prefix);
+int run_headless(const char *path, int frames, int width, int height,
+                 const char *out, bool instancing);
+int run_export(const char *path, const char *mesh, int slices);
 void resize(int w, int h);
 void keyInput(unsigned char key, int x, int y);
 void setup();
-void mat_by_mat(double result[DIM][DIM], double A[DIM][DIM], double B[DIM][DIM]);
-void assign_mat(double result[DIM][DIM], double M[DIM][DIM]);
-void assign_vec(double result[DIM], double A[DIM]);
-void print_mat(double M[DIM][DIM]);
-void print_vec(double A[DIM]);
-void mat_by_vec(double result[DIM], double M[DIM][DIM], double V[DIM]);
-void sum_vec(double result[DIM], double A[DIM], double B[DIM]);
-void Ru_matrix(double R[DIM][DIM], double angle);
-void Rl_matrix(double R[DIM][DIM], double angle);
-void Rh_matrix(double R[DIM][DIM], double angle);
-void get_argument(std::string desc, int start, double *arg, int *jump);
-void read_desc(std::string desc, double *P);
-
-std::string gen_param_tree(int value)
+
+/* Gramática paramétrica de cada árbol predefinido */
+const char *gen_param_tree(int value)
 {
     switch(value)
     {
         case ARBOL_A:
-            lstep = 1.0;
-            langle = 45.0;
-            return "!(30)F(5)[+(35)/(0)!(22.7357484977)F(3.75)[+(35)/(0)!(17.230475325)F(2.8125)[+(35)/(0)!(13.0582584494)F(2.109375)[+(35)/(0)!(9.8963093308)F(1.58203125)[+(35)/(0)!(7.5)F(1.1865234375)[+(35)/(0)!(5.68393712441)F(0.889892578125)[+(35)/(0)!(4.30761883124)F(0.667419433594)[+(35)/(0)!(3.26456461236)F(0.500564575195)[+(35)/(0)!(2.4740773327)F(0.375423431396)[+(35)/(0)!(1.875)F(0.281567573547)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.289076042175)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.3854347229)[+(35)/(0)!(1.875)F(0.289076042175)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.513912963867)[+(35)/(0)!(2.4740773327)F(0.3854347229)[+(35)/(0)!(1.875)F(0.289076042175)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.685217285156)[+(35)/(0)!(3.26456461236)F(0.513912963867)[+(35)/(0)!(2.4740773327)F(0.3854347229)[+(35)/(0)!(1.875)F(0.289076042175)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.913623046875)[+(35)/(0)!(4.30761883124)F(0.685217285156)[+(35)/(0)!(3.26456461236)F(0.513912963867)[+(35)/(0)!(2.4740773327)F(0.3854347229)[+(35)/(0)!(1.875)F(0.289076042175)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.2181640625)[+(35)/(0)!(5.68393712441)F(0.913623046875)[+(35)/(0)!(4.30761883124)F(0.685217285156)[+(35)/(0)!(3.26456461236)F(0.513912963867)[+(35)/(0)!(2.4740773327)F(0.3854347229)[+(35)/(0)!(1.875)F(0.289076042175)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]]]][+(-35)/(0)!(9.8963093308)F(1.62421875)[+(35)/(0)!(7.5)F(1.2181640625)[+(35)/(0)!(5.68393712441)F(0.913623046875)[+(35)/(0)!(4.30761883124)F(0.685217285156)[+(35)/(0)!(3.26456461236)F(0.513912963867)[+(35)/(0)!(2.4740773327)F(0.3854347229)[+(35)/(0)!(1.875)F(0.289076042175)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.2506484375)[+(35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]]]]][+(-35)/(0)!(13.0582584494)F(2.165625)[+(35)/(0)!(9.8963093308)F(1.62421875)[+(35)/(0)!(7.5)F(1.2181640625)[+(35)/(0)!(5.68393712441)F(0.913623046875)[+(35)/(0)!(4.30761883124)F(0.685217285156)[+(35)/(0)!(3.26456461236)F(0.513912963867)[+(35)/(0)!(2.4740773327)F(0.3854347229)[+(35)/(0)!(1.875)F(0.289076042175)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.2506484375)[+(35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]]]][+(-35)/(0)!(9.8963093308)F(1.66753125)[+(35)/(0)!(7.5)F(1.2506484375)[+(35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.2839990625)[+(35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]]]]]][+(-35)/(0)!(17.230475325)F(2.8875)[+(35)/(0)!(13.0582584494)F(2.165625)[+(35)/(0)!(9.8963093308)F(1.62421875)[+(35)/(0)!(7.5)F(1.2181640625)[+(35)/(0)!(5.68393712441)F(0.913623046875)[+(35)/(0)!(4.30761883124)F(0.685217285156)[+(35)/(0)!(3.26456461236)F(0.513912963867)[+(35)/(0)!(2.4740773327)F(0.3854347229)[+(35)/(0)!(1.875)F(0.289076042175)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.2506484375)[+(35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]]]][+(-35)/(0)!(9.8963093308)F(1.66753125)[+(35)/(0)!(7.5)F(1.2506484375)[+(35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.2839990625)[+(35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]]]]][+(-35)/(0)!(13.0582584494)F(2.223375)[+(35)/(0)!(9.8963093308)F(1.66753125)[+(35)/(0)!(7.5)F(1.2506484375)[+(35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.2839990625)[+(35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]]]][+(-35)/(0)!(9.8963093308)F(1.71199875)[+(35)/(0)!(7.5)F(1.2839990625)[+(35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.3182390375)[+(35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(1.01504405888)[+(35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.781583925334)[+(35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.601819622507)[+(35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.46340110933)[+(35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.356818854184)[+(35)/(0)][+(-35)/(0)]]]]]]]]]]][+(-35)/(0)!(22.7357484977)F(3.85)[+(35)/(0)!(17.230475325)F(2.8875)[+(35)/(0)!(13.0582584494)F(2.165625)[+(35)/(0)!(9.8963093308)F(1.62421875)[+(35)/(0)!(7.5)F(1.2181640625)[+(35)/(0)!(5.68393712441)F(0.913623046875)[+(35)/(0)!(4.30761883124)F(0.685217285156)[+(35)/(0)!(3.26456461236)F(0.513912963867)[+(35)/(0)!(2.4740773327)F(0.3854347229)[+(35)/(0)!(1.875)F(0.289076042175)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.2506484375)[+(35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]]]][+(-35)/(0)!(9.8963093308)F(1.66753125)[+(35)/(0)!(7.5)F(1.2506484375)[+(35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.2839990625)[+(35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]]]]][+(-35)/(0)!(13.0582584494)F(2.223375)[+(35)/(0)!(9.8963093308)F(1.66753125)[+(35)/(0)!(7.5)F(1.2506484375)[+(35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.2839990625)[+(35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]]]][+(-35)/(0)!(9.8963093308)F(1.71199875)[+(35)/(0)!(7.5)F(1.2839990625)[+(35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.3182390375)[+(35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(1.01504405888)[+(35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.781583925334)[+(35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.601819622507)[+(35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.46340110933)[+(35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.356818854184)[+(35)/(0)][+(-35)/(0)]]]]]]]]]][+(-35)/(0)!(17.230475325)F(2.9645)[+(35)/(0)!(13.0582584494)F(2.223375)[+(35)/(0)!(9.8963093308)F(1.66753125)[+(35)/(0)!(7.5)F(1.2506484375)[+(35)/(0)!(5.68393712441)F(0.937986328125)[+(35)/(0)!(4.30761883124)F(0.703489746094)[+(35)/(0)!(3.26456461236)F(0.52761730957)[+(35)/(0)!(2.4740773327)F(0.395712982178)[+(35)/(0)!(1.875)F(0.296784736633)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.2839990625)[+(35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]]]][+(-35)/(0)!(9.8963093308)F(1.71199875)[+(35)/(0)!(7.5)F(1.2839990625)[+(35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.3182390375)[+(35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(1.01504405888)[+(35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.781583925334)[+(35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.601819622507)[+(35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.46340110933)[+(35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.356818854184)[+(35)/(0)][+(-35)/(0)]]]]]]]]][+(-35)/(0)!(13.0582584494)F(2.282665)[+(35)/(0)!(9.8963093308)F(1.71199875)[+(35)/(0)!(7.5)F(1.2839990625)[+(35)/(0)!(5.68393712441)F(0.962999296875)[+(35)/(0)!(4.30761883124)F(0.722249472656)[+(35)/(0)!(3.26456461236)F(0.541687104492)[+(35)/(0)!(2.4740773327)F(0.406265328369)[+(35)/(0)!(1.875)F(0.304698996277)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.3182390375)[+(35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(1.01504405888)[+(35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.781583925334)[+(35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.601819622507)[+(35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.46340110933)[+(35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.356818854184)[+(35)/(0)][+(-35)/(0)]]]]]]]][+(-35)/(0)!(9.8963093308)F(1.75765205)[+(35)/(0)!(7.5)F(1.3182390375)[+(35)/(0)!(5.68393712441)F(0.988679278125)[+(35)/(0)!(4.30761883124)F(0.741509458594)[+(35)/(0)!(3.26456461236)F(0.556132093945)[+(35)/(0)!(2.4740773327)F(0.417099070459)[+(35)/(0)!(1.875)F(0.312824302844)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(1.01504405888)[+(35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.781583925334)[+(35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.601819622507)[+(35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.46340110933)[+(35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.356818854184)[+(35)/(0)][+(-35)/(0)]]]]]]][+(-35)/(0)!(7.5)F(1.3533920785)[+(35)/(0)!(5.68393712441)F(1.01504405888)[+(35)/(0)!(4.30761883124)F(0.761283044156)[+(35)/(0)!(3.26456461236)F(0.570962283117)[+(35)/(0)!(2.4740773327)F(0.428221712338)[+(35)/(0)!(1.875)F(0.321166284253)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.781583925334)[+(35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.601819622507)[+(35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.46340110933)[+(35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.356818854184)[+(35)/(0)][+(-35)/(0)]]]]]][+(-35)/(0)!(5.68393712441)F(1.04211190045)[+(35)/(0)!(4.30761883124)F(0.781583925334)[+(35)/(0)!(3.26456461236)F(0.586187944)[+(35)/(0)!(2.4740773327)F(0.439640958)[+(35)/(0)!(1.875)F(0.3297307185)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.601819622507)[+(35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.46340110933)[+(35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.356818854184)[+(35)/(0)][+(-35)/(0)]]]]][+(-35)/(0)!(4.30761883124)F(0.802426163343)[+(35)/(0)!(3.26456461236)F(0.601819622507)[+(35)/(0)!(2.4740773327)F(0.45136471688)[+(35)/(0)!(1.875)F(0.33852353766)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.46340110933)[+(35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.356818854184)[+(35)/(0)][+(-35)/(0)]]]][+(-35)/(0)!(3.26456461236)F(0.617868145774)[+(35)/(0)!(2.4740773327)F(0.46340110933)[+(35)/(0)!(1.875)F(0.347550831998)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.356818854184)[+(35)/(0)][+(-35)/(0)]]][+(-35)/(0)!(2.4740773327)F(0.475758472246)[+(35)/(0)!(1.875)F(0.356818854184)[+(35)/(0)][+(-35)/(0)]][+(-35)/(0)!(1.875)F(0.366334023629)[+(35)/(0)][+(-35)/(0)]]]]]]]]]]]";
-            break;
+            tortuga.lstep = 1.0;
+            tortuga.langle = 45.0;
+            return PRESET_ARBOL_A;
         case ARBOL_G:
-            lstep = 1.0;
-            langle = 45.0;
-            return "!(30)F(5)[+(30)/(137)!(21.2132034356)F(4.0)[+(30)/(137)!(15.0)F(3.2)[+(30)/(137)!(10.6066017178)F(2.56)[+(30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]][+(-30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]]][+(-30)/(137)!(10.6066017178)F(2.56)[+(30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]][+(-30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]]]][+(-30)/(137)!(15.0)F(3.2)[+(30)/(137)!(10.6066017178)F(2.56)[+(30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]][+(-30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]]][+(-30)/(137)!(10.6066017178)F(2.56)[+(30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]][+(-30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]]]]][+(-30)/(137)!(21.2132034356)F(4.0)[+(30)/(137)!(15.0)F(3.2)[+(30)/(137)!(10.6066017178)F(2.56)[+(30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]][+(-30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]]][+(-30)/(137)!(10.6066017178)F(2.56)[+(30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]][+(-30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]]]][+(-30)/(137)!(15.0)F(3.2)[+(30)/(137)!(10.6066017178)F(2.56)[+(30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]][+(-30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]]][+(-30)/(137)!(10.6066017178)F(2.56)[+(30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]][+(-30)/(137)!(7.5)F(2.048)[+(30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]][+(-30)/(137)!(5.3033008589)F(1.6384)[+(30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]][+(-30)/(137)!(3.75)F(1.31072)[+(30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]][+(-30)/(137)!(2.65165042945)F(1.048576)[+(30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]][+(-30)/(137)!(1.875)F(0.8388608)[+(30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]][+(-30)/(137)!(1.32582521472)F(0.67108864)[+(30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]][+(-30)/(137)!(0.9375)F(0.536870912)[+(30)/(137)][+(-30)/(137)]]]]]]]]]]]";
-            break;
+            tortuga.lstep = 1.0;
+            tortuga.langle = 45.0;
+            return PRESET_ARBOL_G;
+        case ARBOL_S:
+            tortuga.lstep = 1.0;
+            tortuga.langle = 45.0;
+            return PRESET_ARBOL_S;
     }
     return "";
 }
 
+/*
+ * Deriva la gramática con la caché de subárboles (memo.h): cada subárbol
+ * distinto se deriva una vez y los demás se copian transformados; al
+ * volver a elegir el mismo árbol en el menú la caché ya está llena.  El
+ * árbol aleatorio no se puede memorizar; se deriva en profundidad con una
+ * semilla nueva cada vez.  Con --shapes se necesitan los comandos: se
+ * deriva la cadena completa.
+ */
+void gen_tree(int value)
+{
+    static uint64_t seed = 0;
+    const char *text = gen_param_tree(value);
+    PresetTree &preset = preset_trees[value];
+
+    TRACE_SCOPE("gen_tree");
+    if (!preset.parsed) {
+        if (!preset.grammar.parse(text)) {
+            fprintf(stderr, "Gramática inválida: %s\n", preset.grammar.error.c_str());
+            return;
+        }
+        preset.parsed = true;
+    }
+    LSystem &grammar = preset.grammar;
+    tortuga.lines.clear();
+    memo_stats = NULL;
+    if (use_shapes) {
+        Derivation d;
+        std::vector<Token> cmds = to_tokens(d.run(grammar, grammar.iterations, seed++));
+        build_shapes(cmds.data(), cmds.size());
+        return;
+    }
+    if (preset.memo.run(grammar, grammar.iterations, tortuga, P, seed++))
+        memo_stats = &preset.memo.stats;
+}
+
+/* Aciertos de la caché de subárboles en la última derivación, si se usó */
+void print_memo_stats(const char *prefix)
+{
+    if (!memo_stats)
+        return;
+    printf("%scaché de subárboles: %zu de %zu búsquedas acertadas (%.1f%%), "
+           "%zu entradas, %zu bytes\n", prefix, memo_stats->hits, memo_stats->lookups,
+           memo_stats->lookups ? 100.0 * memo_stats->hits / memo_stats->lookups : 0.0,
+           memo_stats->entries, memo_stats->bytes);
+}
+
+/*
+ * Modo --shapes: genera el árbol de los comandos como el corte de menos
+ * memoria (subtree.h), sin segmentos planos.  Si no hay instancing o el
+ * corte no ocupa menos que los segmentos planos, los comandos se
+ * interpretan como siempre en tortuga.lines.  Las formas se descartan en
+ * cuanto se elige el corte.
+ */
+void build_shapes(const Token *cmds, size_t n)
+{
+    TRACE_SCOPE("build_shapes");
+    {
+        SubtreeScene scene;
+        scene.build(cmds, n, tortuga, P);
+        shape_info.threshold = scene.choose_layout(SUBTREE_MAX_INSTANCES, layout);
+        shape_info.groups = scene.groups;
+        shape_info.shapes = scene.shapes.size();
+        shape_info.shape_bytes = scene.bytes();
+        shape_info.segments = scene.size();
+        shape_info.flat_bytes = scene.flat_bytes();
+    }
+    shape_info.instances = layout.instances.size();
+    shape_info.layout_bytes = layout.bytes();
+    shape_info.drawn = renderer.instanced() && shape_info.layout_bytes < shape_info.flat_bytes;
+
+    tortuga.lines.clear();
+    if (shape_info.drawn) {
+        tortuga.lines.shrink_to_fit();
+        return;
+    }
+    layout.release();
+    read_desc_parallel(tortuga, cmds, n, P, load_threads);
+}
+
+/* Segmentos del árbol mostrado, estén en tortuga.lines o en el corte */
+size_t tree_segments()
+{
+    return shape_info.drawn ? shape_info.segments : tortuga.lines.size();
+}
+
 void menu(int op)
 {
     switch(op)
     {
         case ARBOL_A:
-            lsystem_desc = gen_param_tree(op);
-            lines.clear();
-            read_desc(lsystem_desc, P);
+            gen_tree(op);
             break;
         case ARBOL_G:
-            lsystem_desc = gen_param_tree(op);
-            lines.clear();
-            read_desc(lsystem_desc, P);
+            gen_tree(op);
+            break;
+        case ARBOL_S:
+            gen_tree(op);
             break;
         case SALIR:
             glutDestroyWindow(window);
@@ -131,6 +272,7 @@ void menu(int op)
             break;
     }
     menu_value = op;
+    TRACE_COUNTERS("carga");
     glutPostRedisplay();
 }
 
@@ -141,6 +283,7 @@ void createMenu(void)
     arboles_id = glutCreateMenu(menu);
     glutAddMenuEntry("Arbol A", ARBOL_A);
     glutAddMenuEntry("Arbol G", ARBOL_G);
+    glutAddMenuEntry("Arbol aleatorio", ARBOL_S);
     
     fractales_id = glutCreateMenu(menu);
     glutAddMenuEntry("Circulo", FRACTAL_A);
@@ -154,7 +297,15 @@ void createMenu(void)
 }
 
 void drawScene() {
-    float distance = 15.0;
+    TRACE_SCOPE("drawScene");
+    render_scene();
+    glutSwapBuffers();
+
+    if (fps_frames) fps_frame();
+}
+
+/* Dibuja la escena completa en el buffer actual (con o sin ventana) */
+void render_scene() {
     float XRad = XAngle / 180 * PI;
     float YRad = YAngle / 180 * PI;
     float x = sin(XRad) * distance;
@@ -167,6 +318,7 @@ void drawScene() {
     float matSpec[] = {1.0, 1.0, 1.0, 1.0};
     float matShine[] = {50.0};
 
+    TRACE_SCOPE("render_scene");
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -179,12 +331,16 @@ void drawScene() {
 
     glDisable(GL_LIGHTING);
 
-    glPushMatrix();
-    glLightfv(GL_LIGHT0, GL_POSITION, lightPos0);
-    glTranslatef(lightPos0[0], lightPos0[1], lightPos0[2]);
-    glColor3f(1.0, 1.0, 1.0);
-    glutWireSphere(0.05, 8, 8);
-    glPopMatrix();
+    {
+        TRACE_SCOPE("luz");
+        glPushMatrix();
+        glLightfv(GL_LIGHT0, GL_POSITION, lightPos0);
+        glTranslatef(lightPos0[0], lightPos0[1], lightPos0[2]);
+        glColor3f(1.0, 1.0, 1.0);
+        gluSphere(light_quadric, 0.05, 8, 8);
+        glPopMatrix();
+        TRACE_COUNT(TRACE_QUADRICS, 1);
+    }
 
     glEnable(GL_LIGHTING);
 
@@ -192,6 +348,61 @@ void drawScene() {
     glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, matSpec);
     glMaterialfv(GL_FRONT_AND_BACK, GL_SHININESS, matShine);
 
+    /* Piso (no cambia, se compila una sola vez en setup) */
+    {
+        TRACE_SCOPE("piso");
+        glCallList(floor_list);
+        TRACE_COUNT(TRACE_TRIANGLES, floor_triangles);
+        TRACE_COUNT(TRACE_DRAW_CALLS, 1);
+    }
+
+    /* Renderizar un árbol */
+    if(menu_value >= ARBOL_A && menu_value <= ARBOL_G)
+    {
+        TRACE_SCOPE("arbol");
+        /* Se renderizan los segmentos que conforman el fractal. */
+        glColor4f(0.0, 1.0, 1.0, 1.0);
+        if (shape_info.drawn)
+            renderer.draw(layout);
+        else
+            renderer.draw(tortuga.lines);
+    }
+    TRACE_COUNTERS("cuadro");
+}
+
+/*
+ * Modo --fps: el primer cuadro no se cuenta (sube los datos y compila el
+ * shader); al completar N cuadros se informa el promedio y se termina.
+ */
+void fps_frame() {
+    if (fps_count++ == 0) {
+        glFinish();
+        fps_start = std::chrono::steady_clock::now();
+        return;
+    }
+    if (fps_count > fps_frames) {
+        glFinish();
+        double secs = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - fps_start).count();
+        printf("%d cuadros en %.3f s: %.1f fps, %.2f ms por cuadro "
+               "(%zu segmentos, %zu triángulos, %s, %lu subidas)\n",
+               fps_frames, secs, fps_frames / secs, 1000.0 * secs / fps_frames,
+               tree_segments(), renderer.triangles(),
+               renderer.instanced() ? "instanciado" : "teselado", renderer.uploads());
+        print_memo_stats("");
+        exit(EXIT_SUCCESS);
+    }
+}
+
+void fps_idle() {
+    XAngle += 360.0 / fps_frames;
+    glutPostRedisplay();
+}
+
+/* Piso de cuadros, guardado en una display list */
+void build_floor() {
+    floor_list = glGenLists(1);
+    glNewList(floor_list, GL_COMPILE);
     int i = 0;
     for (float v = 100.0; v > -100.0; v -= 5.0) {
         glBegin(GL_TRIANGLE_STRIP);
@@ -203,28 +414,13 @@ void drawScene() {
             glVertex3f(u, 0.0, v);
             glVertex3f(u + 5.0, 0.0, v - 5.0);
             glVertex3f(u + 5.0, 0.0, v);
+            floor_triangles += 2;
             i++;
         }
         glEnd();
         i++;
     }
-
-    /* Renderizar un árbol */
-    if(menu_value >= ARBOL_A && menu_value <= ARBOL_G)
-    {
-        /* Se renderizan los segmentos que conforman el fractal. */
-        glColor4f(0.0, 1.0, 1.0, 1.0);
-        GLUquadricObj *quadratic = gluNewQuadric();
-        for (auto l : lines) {
-            glPushMatrix();
-            quadratic = gluNewQuadric();
-            /* Matriz de transformación generada por el L-system */
-            glMultMatrixd(l.T);
-            gluCylinder(quadratic, 0.02f*l.width, 0.02f*(l.width-(0.2*l.width)), l.size, 30, 30);
-            glPopMatrix();
-        }
-    }
-    glutSwapBuffers();
+    glEndList();
 }
 
 void resize(int w, int h) {
@@ -240,6 +436,14 @@ void keyInput(unsigned char key, int x, int y) {
         case ESC:
             exit(EXIT_SUCCESS);
             break;
+        case '+':
+            if (distance > 1.0) distance -= 1.0;
+            glutPostRedisplay();
+            break;
+        case '-':
+            distance += 1.0;
+            glutPostRedisplay();
+            break;
         default:
             break;
     }
@@ -278,405 +482,252 @@ void setup() {
 
     glEnable(GL_LIGHT0); // Activar luz 0.
     glLightModelfv(GL_LIGHT_MODEL_AMBIENT, globAmb);
-}
 
-int main(int argc, char* argv[]) {
-    /* OpenGL related calls. */
-    glutInit(&argc, argv);
-    /*glutInitContextVersion(2, 1);
-    glutInitContextProfile(GLUT_COMPATIBILITY_PROFILE);*/
-    glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA | GLUT_DEPTH);
-
-    glutInitWindowSize(500, 500);
-    glutInitWindowPosition(100, 100);
-    window = glutCreateWindow("Proyecto de Computación Gráfica");
-    createMenu();
+    /* Esfera de alambre que marca la luz */
+    light_quadric = gluNewQuadric();
+    gluQuadricDrawStyle(light_quadric, GLU_LINE);
 
-    glutDisplayFunc(drawScene);
-    glutReshapeFunc(resize);
-    glutKeyboardFunc(keyInput);
-    glutSpecialFunc(specialKeyInput);
-
-    glewInit();
-
-    setup();
-
-    glutMainLoop();
-
-    return EXIT_SUCCESS;
-}
-
-/* Operaciones sobre matrices */
-
-/* Multiplicación de matrices */
-void mat_by_mat(double result[DIM][DIM], double A[DIM][DIM], double B[DIM][DIM]) {
-    int i, j, k;
-    double sum;
-    for (i = 0; i < DIM; i++) {
-        for (j = 0; j < DIM; j++) {
-            sum = 0.0;
-            for (k = 0; k < DIM; k++) {
-                sum += A[i][k] * B[k][j];
-            }
-            result[i][j] = sum;
-        }
-    }
-}
-
-/* Guarda el resultado de una matriz en otra */
-void assign_mat(double result[DIM][DIM], double M[DIM][DIM]) {
-    int i, j;
-    for (i = 0; i < DIM; i++)
-        for (j = 0; j < DIM; j++)
-            result[i][j] = M[i][j];
+    build_floor();
 }
 
-/* Guarda el resultado de un vector en otro */
-void assign_vec(double result[DIM], double A[DIM]) {
-    int i;
-    for (i = 0; i < DIM; i++)
-        result[i] = A[i];
+/* true si la entrada estándar viene de un archivo o un pipe */
+bool stdin_redirected() {
+    struct stat st;
+    return fstat(STDIN_FILENO, &st) == 0 && (S_ISREG(st.st_mode) || S_ISFIFO(st.st_mode));
 }
 
-/* Imprimir matriz */
-void print_mat(double M[DIM][DIM]) {
-    int i, j;
-    printf("\n");
-    for (i = 0; i < DIM; i++) {
-        for (j = 0; j < DIM; j++)
-            printf("%f ", M[i][j]);
-        printf("\n");
+/*
+ * Carga un archivo con el formato de data/N.txt ("-" es la entrada
+ * estándar).  La descripción se interpreta sobre el archivo proyectado.
+ * Los archivos .lsb (ver lsb.h) se reconocen por su cabecera y sus
+ * comandos se ejecutan sin tokenizar.
+ */
+bool load_tree(const char *path) {
+    DescFile f;
+
+    TRACE_SCOPE("load_tree");
+    memo_stats = NULL;
+    if (strcmp(path, "-") && lsb_probe(path)) {
+        LsbFile lsb;
+        if (!lsb.open(path))
+            return false;
+        tortuga.lstep = lsb.header->lstep;
+        tortuga.langle = lsb.header->langle;
+        tortuga.lwidth = lsb.header->lwidth;
+        tortuga.lines.clear();
+        if (use_shapes)
+            build_shapes(lsb.cmds, lsb.count);
+        else
+            read_desc_parallel(tortuga, lsb.cmds, lsb.count, P, load_threads);
+        menu_value = ARBOL_A;
+        return true;
     }
-    printf("\n");
-}
-
-/* Imprimir vector */
-void print_vec(double A[DIM]) {
-    int i;
-    printf("\n");
-    for (i = 0; i < DIM; i++)
-        printf("%f ", A[i]);
-    printf("\n\n");
-}
-
-/* Multiplica matriz por vector */
-void mat_by_vec(double result[DIM], double M[DIM][DIM], double V[DIM]) {
-    int i, j;
-    for (i = 0; i < DIM; i++) {
-        result[i] = 0;
-        for (j = 0; j < DIM; j++)
-            result[i] += M[i][j] * V[j];
+    if (!f.open(path)) {
+        fprintf(stderr, "No se pudo leer %s\n", strcmp(path, "-") ? path : "la entrada estándar");
+        return false;
+    }
+    tortuga.lstep = f.step;
+    tortuga.langle = f.angle;
+    tortuga.lines.clear();
+    /* En paralelo o con --shapes hacen falta los comandos; si no, se interpreta el texto */
+    if (use_shapes) {
+        std::vector<Token> cmds = tokenize(f.desc, f.size);
+        build_shapes(cmds.data(), cmds.size());
     }
+    else if (load_threads != 1) {
+        std::vector<Token> cmds = tokenize(f.desc, f.size);
+        read_desc_parallel(tortuga, cmds, P, load_threads);
+    }
+    else
+        tortuga.read_desc(f.desc, f.size, P);
+    menu_value = ARBOL_A;
+    return true;
 }
 
-/* Suma dos vectores */
-void sum_vec(double result[DIM], double A[DIM], double B[DIM]) {
-    int i;
-    for (i = 0; i < DIM; i++)
-        result[i] = A[i] + B[i];
+/* Archivo indicado, entrada estándar redirigida o, si no, el árbol A */
+bool load_default_tree(const char *path) {
+    if (path)
+        return load_tree(path);
+    if (stdin_redirected())
+        return load_tree("-");
+    gen_tree(ARBOL_A);
+    menu_value = ARBOL_A;
+    return true;
 }
 
 /*
- * Matrices de transformación
+ * Modo sin ventana: una vuelta de la cámara en 'frames' cuadros.  Por cada
+ * cuadro se informa el tiempo de CPU del proceso (incluye los hilos de
+ * llvmpipe) y el tiempo total hasta que el cuadro está terminado.
  */
+int run_headless(const char *path, int frames, int width, int height,
+                 const char *out, bool instancing) {
+    double cpu_sum = 0, wall_sum = 0;
+
+    if (!headless_init(width, height))
+        return EXIT_FAILURE;
+    /*
+     * GLEW compilado para GLX no encuentra display y devuelve error, pero
+     * las funciones de OpenGL quedan cargadas: basta con revisar la versión.
+     */
+    GLenum err = glewInit();
+    if (err != GLEW_OK && !GLEW_VERSION_1_5) {
+        fprintf(stderr, "GLEW: %s\n", glewGetErrorString(err));
+        return EXIT_FAILURE;
+    }
 
-/* Rotar en torno a eje U (Z) */
-void Ru_matrix(double R[DIM][DIM], double angle) {
-    double alfa = (angle * PI)/180.0;
-    double mat[DIM][DIM] = {
-        {cos(alfa), sin(alfa), 0},
-        {sin(alfa * -1.0), cos(alfa), 0},
-        {0, 0, 1}
-    };
-    assign_mat(R, mat);
-}
+    setup();
+    renderer.init(instancing);
+    resize(width, height);
+    if (!load_default_tree(path))
+        return EXIT_FAILURE;
+    TRACE_COUNTERS("carga");
+
+    printf("# %s, %dx%d, %zu segmentos, %s\n", glGetString(GL_RENDERER), width, height,
+           tree_segments(), renderer.instanced() ? "instanciado" : "teselado");
+    if (use_shapes)
+        printf("# %zu grupos, %zu formas (%zu bytes, ya liberados), corte en %zu con %zu "
+               "instancias: %zu bytes contra %zu planos; se dibuja %s, residentes %zu bytes\n",
+               shape_info.groups, shape_info.shapes, shape_info.shape_bytes,
+               shape_info.threshold, shape_info.instances, shape_info.layout_bytes,
+               shape_info.flat_bytes, shape_info.drawn ? "el corte" : "plano",
+               layout.bytes() + tortuga.lines.bytes());
+    print_memo_stats("# ");
+    printf("# cuadro cpu_ms total_ms visibles\n");
+    for (int i = 0; i < frames; i++) {
+        XAngle = 360.0 * i / frames;
+
+        std::clock_t c0 = std::clock();
+        auto t0 = std::chrono::steady_clock::now();
+        render_scene();
+        glFinish();
+        double cpu = 1000.0 * (std::clock() - c0) / CLOCKS_PER_SEC;
+        double wall = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - t0).count();
+
+        printf("%d %.3f %.3f %zu\n", i, cpu, wall, renderer.visible());
+        cpu_sum += cpu;
+        wall_sum += wall;
+
+        if (out) {
+            char name[1024];
+            snprintf(name, sizeof(name), "%s%04d.ppm", out, i);
+            if (!write_ppm(name, width, height))
+                fprintf(stderr, "No se pudo escribir %s\n", name);
+        }
+    }
+    if (frames > 0)
+        printf("# promedio: cpu %.3f ms, total %.3f ms (%.1f fps, %zu triángulos)\n",
+               cpu_sum / frames, wall_sum / frames, 1000.0 * frames / wall_sum,
+               renderer.triangles());
 
-/* Rotar en torno a eje Z */
-void Rz_matrix(double R[DIM][DIM], double angle) {
-    double alfa = (angle * PI)/180.0;
-    double mat[DIM][DIM] = {
-        {cos(alfa), sin(alfa * -1.0), 0},
-        {sin(alfa), cos(alfa), 0},
-        {0, 0, 1}
-    };
-    assign_mat(R, mat);
+    renderer.release();
+    headless_release();
+    return EXIT_SUCCESS;
 }
 
-/* Rotar en torno a eje L (Y) */
-void Rl_matrix(double R[DIM][DIM], double angle) {
-    double alfa = (angle * PI)/180.0;
-    double mat[DIM][DIM] = {
-        {cos(alfa), 0, sin(alfa * -1.0)},
-        {0, 1, 0},
-        {sin(alfa), 0, cos(alfa)}
-    };
-    assign_mat(R, mat);
-}
+/* Exporta el árbol a una malla (.ply o .glb) sin abrir ventana */
+int run_export(const char *path, const char *mesh, int slices) {
+    MeshStats stats;
 
-/* Rotar en torno a eje Y */
-void Ry_matrix(double R[DIM][DIM], double angle) {
-    double alfa = (angle * PI)/180.0;
-    double mat[DIM][DIM] = {
-        {cos(alfa), 0, sin(alfa)},
-        {0, 1, 0},
-        {sin(alfa * -1.0), 0, cos(alfa)}
-    };
-    assign_mat(R, mat);
-}
+    if (!load_default_tree(path))
+        return EXIT_FAILURE;
+    TRACE_COUNTERS("carga");
 
-/* Rotar en torno a eje H (X) */
-void Rh_matrix(double R[DIM][DIM], double angle) {
-    double alfa = (angle * PI)/180.0;
-    double mat[DIM][DIM] = {
-        {1, 0, 0},
-        {0, cos(alfa), sin(alfa * -1.0)},
-        {0, sin(alfa), cos(alfa)}
-    };
-    assign_mat(R, mat);
+    auto start = std::chrono::steady_clock::now();
+    if (!export_mesh(mesh, tortuga.lines, slices, &stats)) {
+        fprintf(stderr, "No se pudo exportar a %s\n", mesh);
+        return EXIT_FAILURE;
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    printf("%s: %zu segmentos (%zu soldados), %zu vértices, %zu triángulos, %.1f ms\n",
+           mesh, tortuga.lines.size(), stats.welded, stats.vertices, stats.triangles, ms);
+    return EXIT_SUCCESS;
 }
 
-/* Rotar en torno a eje X */
-void Rx_matrix(double R[DIM][DIM], double angle) {
-    double alfa = (angle * PI)/180.0;
-    double mat[DIM][DIM] = {
-        {1, 0, 0},
-        {0, cos(alfa), sin(alfa * -1.0)},
-        {0, sin(alfa), cos(alfa)}
-    };
-    assign_mat(R, mat);
-}
+int main(int argc, char* argv[]) {
+    const char *path = NULL;
+    const char *out = NULL;
+    const char *mesh = NULL;
+    int slices = EXPORT_SLICES;
+    bool instancing = true;
+    int headless_frames = 0;
+    int width = 500, height = 500;
+
+    /* Sin ventana no se llama a glutInit, que necesita un servidor gráfico */
+    bool headless = false;
+    for (int i = 1; i < argc; i++)
+        if (!strcmp(argv[i], "--headless") || !strcmp(argv[i], "--export")) headless = true;
 
-void assign_GL_mat(LineSegment *LS, double M[DIM][DIM])
-{
-	double T[DIM][DIM], R[DIM][DIM];
-	//printf("M matrix:\n");
-	//print_mat(M);
-	Ry_matrix(R, 90.0);
-    /* Aplicar la transformación R a T: T*R */
-	mat_by_mat(T, M, R);
-	
-	//printf("T matrix:\n");
-	//print_mat(T);
-                
-	LS->T[0] = T[0][0];
-	LS->T[1] = T[1][0];
-	LS->T[2] = T[2][0];
-	LS->T[3] = 0.0;
-	LS->T[4] = T[0][1];
-	LS->T[5] = T[1][1];
-	LS->T[6] = T[2][1];
-	LS->T[7] = 0.0;
-	LS->T[8] = T[0][2];
-	LS->T[9] = T[1][2];
-	LS->T[10] = T[2][2];
-	LS->T[11] = 0.0;
-	LS->T[12] = LS->P0[0];
-	LS->T[13] = LS->P0[1];
-	LS->T[14] = LS->P0[2];
-	LS->T[15] = 1.0;
-}
+    /* OpenGL related calls. */
+    if (!headless)
+        glutInit(&argc, argv);
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--fps") && i + 1 < argc)
+            fps_frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--headless") && i + 1 < argc)
+            headless_frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--size") && i + 1 < argc)
+            sscanf(argv[++i], "%dx%d", &width, &height);
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc)
+            out = argv[++i];
+        else if (!strcmp(argv[i], "--export") && i + 1 < argc)
+            mesh = argv[++i];
+        else if (!strcmp(argv[i], "--slices") && i + 1 < argc)
+            slices = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--legacy"))
+            instancing = false;
+        else if (!strcmp(argv[i], "--shapes"))
+            use_shapes = true;
+        else if (!strcmp(argv[i], "--nocull"))
+            renderer.set_culling(false);
+        else if (!strcmp(argv[i], "--distance") && i + 1 < argc)
+            distance = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--lod") && i + 1 < argc)
+            renderer.set_lod(atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+            load_threads = (unsigned)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--trace") && i + 1 < argc)
+            TRACE_OPEN(argv[++i]);
+        else
+            path = argv[i];
+    }
 
-/*
- * Leer el string de descripción desde el índice 'start' hasta encontrar
- * un cierre de paréntesis.  Asumimos que la string es una cadena bien
- * formada (con paréntesis balanceados).
- * Convertir el argumento leído entre paréntesis a un número flotante
- * (double). Además, calcular la cantidad de caractéres que hemos leído.
- * Si no hay argumento, 0 caracteres son leídos.
- */
-void get_argument(std::string desc, int start, double *arg, int *jump) {
-    int i = start;
-    char str_arg[MAX_DESC+1];
-    
-    memset(str_arg, 0, MAX_DESC+1);
+    if (mesh)
+        return run_export(path, mesh, slices);
+    if (headless)
+        return run_headless(path, headless_frames, width, height, out, instancing);
 
-    if (desc[i+1] == '(') {
-        i += 2;
-        while (desc[i] != ')') {
-            str_arg[i - start - 2] = desc[i];
-            i++;
-        }
+    /*glutInitContextVersion(2, 1);
+    glutInitContextProfile(GLUT_COMPATIBILITY_PROFILE);*/
+    glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA | GLUT_DEPTH);
 
-        /* atof: convierte string a float/double */
-        *arg = atof(str_arg);
-        *jump = i - start;
-    }
-    else
-        /* Un salto de 0 significa que no hay argumento */
-        *jump = 0;
-}
+    glutInitWindowSize(width, height);
+    glutInitWindowPosition(100, 100);
+    window = glutCreateWindow("Proyecto de Computación Gráfica");
+    createMenu();
 
-void read_desc(std::string desc, double *P) {
-    char action;
-    double arg;
-    int jump = 0, push = 0, pop = 0;
-    /* Matriz para almacenar transformaciones a lo largo de iteraciones
-     * En un comienzo apunta hacia Y+, ya que la primera columna indica
-     * el Heading (hacia dónde apunta), la seguna cuál es la dirección 
-     * hacia la izquierda (en este caso hacia X+) y cual es la dirección
-     * hacia arriba (en este caso Z+). Cuando fue descrita por Lindenmayer
-     * et al en "The Algorithmic Beauty of Plants" esta matriz es mencionada
-     * como [H L U] (por Heading, Left, Up). */
-    double T[DIM][DIM] = {{0, 1, 0}, {1, 0, 0}, {0, 0, 1}};
-    /* Matriz para guardar rotaciones y resultados de operaciones */
-    double R[DIM][DIM];
-    double M[DIM][DIM];
-    /* Vector para almacenar tamaño de segmento a dibujar */
-    double L[DIM] = {0, 0, 0};
-    /* Punto inicial */
-    double P0[DIM] = {P[0], P[1], P[2]};
-    LineSegment LS;
-
-    //std::pair<std::array<double, 3>, std::array<double, 3>> line;
-
-    /* Estado inicial */
-    assign_mat(EstadoActual.T, T);
-    assign_vec(EstadoActual.P, P0);
-    EstadoActual.width = DEFAULT_WIDTH;
-
-    for (unsigned int i = 0; i < desc.size(); i++) {
-        /* Lee caracter y verifica si existe argumento */
-        action = desc[i];
-        get_argument(desc, i, &arg, &jump);
-
-        /* Obtiene estado actual */
-        assign_mat(T, EstadoActual.T);
-        assign_vec(P0, EstadoActual.P);
-
-        /* Los casos se describen en "L-systems: from the Theory to Visual Models of Plants"
-         * Apartado num. 5: The turtle interpretation of L-systems */
-        switch (action) {
-            case 'F':
-                /* Si no hay argumento, entonces tomar valor por defecto */
-                if (!jump) arg = lstep;
-
-                /* Tamaño del segmento a dibujar */
-                L[0] = arg;
-                mat_by_vec(P, T, L);
-                
-                LS.P0[0] = P0[0];
-                LS.P0[1] = P0[1];
-                LS.P0[2] = P0[2];
-                
-                sum_vec(P0, P, P0);
-                
-                LS.P1[0] = P0[0];
-                LS.P1[1] = P0[1];
-                LS.P1[2] = P0[2];
-                
-                LS.width 	= EstadoActual.width;
-                LS.size 	= arg;
-                LS.color 	= 0.0;
-                
-                assign_GL_mat(&LS, T);
-                
-                lines.push_back(LS);
-                break;
-            case '+':
-                if (!jump) arg = langle;
-
-                //Ru
-                Rz_matrix(R, arg*-1.0);
-                /* Aplicar la transformación R a T: T*R */
-                mat_by_mat(M, T, R);
-                assign_mat(T, M);
-
-                if (DEBUG) printf("Rotar hacia izquierda en torno a eje U.  Ru(%f)\n", arg);
-                break;
-            case '-':
-                if (!jump) arg = langle;
-
-                //Ru
-                Rz_matrix(R, arg);
-                /* Aplicar la transformación R a T: T*R */
-                mat_by_mat(M, T, R);
-                assign_mat(T, M);
-
-                if (DEBUG) printf("Rotar hacia derecha en torno a eje U. Ru(-%f)\n", arg);
-                break;
-            case '&':
-                if (!jump) arg = langle;
-
-                //Rl
-                Ry_matrix(R, arg*-1.0);
-                /* Aplicar la transformación R a T: T*R */
-                mat_by_mat(M, T, R);
-                assign_mat(T, M);
-
-                if (DEBUG) printf("Rotar hacia izquierda en torno a eje L. Rl(%f)\n", arg);
-                break;
-            case '^':
-                if (!jump) arg = langle;
-
-                //Rl
-                Ry_matrix(R, arg);
-                /* Aplicar la transformación R a T: T*R */
-                mat_by_mat(M, T, R);
-                assign_mat(T, M);
-
-                if (DEBUG) printf("Rotar hacia derecha en torno a eje L. Rl(-%f)\n", arg);
-                break;
-            case '/':
-                if (!jump) arg = langle;
-
-                //Rh
-                Rx_matrix(R, arg*-1.0);
-                /* Aplicar la transformación R a T: T*R */
-                mat_by_mat(M, T, R);
-                assign_mat(T, M);
-
-                if (DEBUG) printf("Rotar hacia izquierda en torno a eje H. Rh(%f)\n", arg);
-                break;
-            case '\\':
-                if (!jump) arg = langle;
-
-                //Rh
-                Rx_matrix(R, arg);
-                /* Aplicar la transformación R a T: T*R */
-                mat_by_mat(M, T, R);
-                assign_mat(T, M);
-
-                if (DEBUG) printf("Rotar hacia derecha en torno a eje H. Rh(-%f)\n", arg);
-                break;
-            case '[':
-
-                /* Seteamos flag para hacer push del estado actual */
-                push = 1;
-
-                if (DEBUG) printf("Guardar el estado actual en la pila.\n");
-                break;
-            case ']':
-
-                /* Seteamos flag para hacer pop de la pila y actualizar estado */
-                pop = 1;
-
-                if (DEBUG) printf("Obtener estado desde la pila y actualizarlo como estado actual.\n");
-                break;
-            case '!':
-				if (!jump) arg = lwidth;
-				
-				EstadoActual.width = arg;
-				
-				break;
-            default:
-                break;
-        }
-        i += jump;
+    glutDisplayFunc(drawScene);
+    glutReshapeFunc(resize);
+    glutKeyboardFunc(keyInput);
+    glutSpecialFunc(specialKeyInput);
 
-        /* Guardar estado actual */
-        assign_mat(EstadoActual.T, T);
-        assign_vec(EstadoActual.P, P0);
+    glewInit();
 
-        /* Verificamos si debemos sacar el estado actual desde la pila */
-        if (pop && !PilaEstados.empty()) {
-            EstadoActual = PilaEstados.top();
-            PilaEstados.pop();
-            pop = 0;
-        }
-        /* Verificamos si debemos guardar estado actual en la pila */
-        else if (push) {
-            PilaEstados.push(EstadoActual);
-            push = 0;
-        }
+    setup();
+    renderer.init(instancing);
+
+    if (fps_frames > 0) {
+        if (!load_default_tree(path))
+            return EXIT_FAILURE;
+        glutIdleFunc(fps_idle);
     }
+    else if ((path || stdin_redirected()) && !load_tree(path ? path : "-"))
+        return EXIT_FAILURE;
+    TRACE_COUNTERS("carga");
+
+    glutMainLoop();
+
+    return EXIT_SUCCESS;
 }
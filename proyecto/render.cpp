@@ -0,0 +1,698 @@
+/**
+ * L-systems: dibujo instanciado de los segmentos del árbol.
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "lsystem.h"
+#include "render.h"
+#include "trace.h"
+
+/* Atributos de vértice del shader */
+enum {
+    ATTR_VERTEX,
+    ATTR_POS,
+    ATTR_QUAT,
+    ATTR_WIDTH,
+    ATTR_LENGTH
+};
+
+/* Lados de los cilindros de cada nivel */
+static const int LOD_SLICES[LOD_CYLINDERS] = {CYL_SLICES, 16, 8, 4};
+/* Diámetro proyectado mínimo, en píxeles, de cada nivel de cilindro */
+static const double LOD_MIN_PIXELS[LOD_CYLINDERS] = {32.0, 12.0, 4.0, 1.0};
+
+/*
+ * Cada vértice de la malla es (sin, cos, z) con z en {0, 1}.  Las líneas
+ * y los puntos usan vértices sobre el manto (sin = 0, cos = 1), con lo
+ * que reciben la normal de ese lado del cilindro.  El shader
+ * escala el radio según el grosor y el largo según el segmento, y rota
+ * con el cuaternión guardado.  gl_matrix aplica T*Ry(90) al cilindro, que
+ * con la columna U invertida equivale a llevar (x, y, z) a (z, y, x)
+ * antes de rotar por el cuaternión.
+ *
+ * Con un corte de subárboles (SHAPES definido) cada instancia lleva
+ * además su transformación en uniforms: el segmento local se escala, se
+ * rota por 'rotation' y se traslada a 'origin'.  Es otro programa para
+ * que el de los segmentos planos no haga ese trabajo.
+ *
+ * La iluminación es la del pipeline fijo por vértice: luz 0, modelo de
+ * luz ambiente, material especular y glColor como ambiente y difuso
+ * (GL_COLOR_MATERIAL), con observador en el infinito.
+ */
+static const char *VERTEX_SHADER = R"(
+attribute vec3 vertex;
+attribute vec3 inst_pos;
+attribute vec4 inst_quat;
+attribute float inst_width;
+attribute float inst_length;
+varying vec4 color;
+#ifdef SHAPES
+uniform vec3 origin;
+uniform vec4 rotation;
+uniform vec2 scale;
+#endif
+
+vec3 qrot(vec4 q, vec3 v) {
+    return v + 2.0 * cross(q.xyz, cross(q.xyz, v) + q.w * v);
+}
+
+#ifdef SHAPES
+vec4 qmul(vec4 a, vec4 b) {
+    return vec4(a.w * b.xyz + b.w * a.xyz + cross(a.xyz, b.xyz), a.w * b.w - dot(a.xyz, b.xyz));
+}
+#endif
+
+void main() {
+#ifdef SHAPES
+    vec4 q = qmul(rotation, normalize(inst_quat));
+    float len = scale.x * inst_length;
+    float r0 = RADIUS * scale.y * inst_width;
+    vec3 pos = origin + qrot(rotation, scale.x * inst_pos);
+#else
+    vec4 q = normalize(inst_quat);
+    float len = inst_length;
+    float r0 = RADIUS * inst_width;
+    vec3 pos = inst_pos;
+#endif
+    float r = r0 * mix(1.0, TAPER, vertex.z);
+    vec3 local = vec3(vertex.z * len, vertex.y * r, vertex.x * r);
+    /* F(0) da un disco: normales radiales, como en export.cpp */
+    vec3 normal = vec3(len > 0.0 ? r0 * (1.0 - TAPER) / len : 0.0, vertex.y, vertex.x);
+
+    vec4 eye = gl_ModelViewMatrix * vec4(pos + qrot(q, local), 1.0);
+    vec3 n = normalize(gl_NormalMatrix * qrot(q, normal));
+    vec3 L = normalize(gl_LightSource[0].position.xyz - eye.xyz * gl_LightSource[0].position.w);
+    float nl = max(dot(n, L), 0.0);
+
+    vec4 c = gl_FrontMaterial.emission + gl_Color * gl_LightModel.ambient
+           + gl_Color * gl_LightSource[0].ambient
+           + nl * gl_Color * gl_LightSource[0].diffuse;
+    if (nl > 0.0) {
+        float nh = max(dot(n, normalize(L + vec3(0.0, 0.0, 1.0))), 0.0);
+        c += pow(nh, gl_FrontMaterial.shininess) *
+             gl_FrontMaterial.specular * gl_LightSource[0].specular;
+    }
+    color = vec4(clamp(c.rgb, 0.0, 1.0), gl_Color.a);
+    gl_Position = gl_ProjectionMatrix * eye;
+}
+)";
+
+static const char *FRAGMENT_SHADER = R"(
+varying vec4 color;
+
+void main() {
+    gl_FragColor = color;
+}
+)";
+
+static GLuint compile_shader(GLenum type, const std::string &src) {
+    const char *text = src.c_str();
+    GLuint shader = glCreateShader(type);
+    GLint ok;
+
+    glShaderSource(shader, 1, &text, NULL);
+    glCompileShader(shader);
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+    if (!ok) {
+        char log[1024];
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        fprintf(stderr, "Error al compilar shader: %s\n", log);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+TreeRenderer::TreeRenderer()
+    : program(0), shape_program(0), mesh_vbo(0), index_vbo(0), inst_vbo{0, 0, 0, 0},
+      uniform_origin(-1), uniform_rotation(-1), uniform_scale(-1),
+      count(0), culling(true), cull_stats{0, 0, 0}, forced_lod(-1), lod_count{0},
+      source(NULL), version(0), upload_count(0), world_vbo(0) {
+}
+
+bool TreeRenderer::init(bool use_instancing) {
+    if (use_instancing && GLEW_VERSION_3_3 && (program = build_program(false))) {
+        shape_program = build_program(true);
+        if (shape_program) {
+            uniform_origin = glGetUniformLocation(shape_program, "origin");
+            uniform_rotation = glGetUniformLocation(shape_program, "rotation");
+            uniform_scale = glGetUniformLocation(shape_program, "scale");
+        }
+        build_mesh();
+        glGenBuffers(4, inst_vbo);
+    }
+    else
+        glGenBuffers(1, &world_vbo);
+    return instanced();
+}
+
+void TreeRenderer::release() {
+    if (shape_program) {
+        glDeleteProgram(shape_program);
+        shape_program = 0;
+    }
+    if (program) {
+        glDeleteProgram(program);
+        glDeleteBuffers(1, &mesh_vbo);
+        glDeleteBuffers(1, &index_vbo);
+        glDeleteBuffers(4, inst_vbo);
+        program = 0;
+    }
+    if (world_vbo) {
+        glDeleteBuffers(1, &world_vbo);
+        world_vbo = 0;
+    }
+    count = 0;
+    source = NULL;
+    bvh.clear();
+}
+
+/* Programa de los segmentos planos o, con 'shapes', de las instancias del corte */
+GLuint TreeRenderer::build_program(bool shapes) {
+    char defs[128];
+    GLint ok;
+
+    snprintf(defs, sizeof(defs), "#version 120\n#define RADIUS %.9g\n#define TAPER %.9g\n%s",
+             CYL_RADIUS, CYL_TAPER, shapes ? "#define SHAPES\n" : "");
+    GLuint vs = compile_shader(GL_VERTEX_SHADER, std::string(defs) + VERTEX_SHADER);
+    GLuint fs = compile_shader(GL_FRAGMENT_SHADER, std::string(defs) + FRAGMENT_SHADER);
+    if (!vs || !fs) {
+        if (vs) glDeleteShader(vs);
+        if (fs) glDeleteShader(fs);
+        return 0;
+    }
+
+    GLuint prog = glCreateProgram();
+    glAttachShader(prog, vs);
+    glAttachShader(prog, fs);
+    glBindAttribLocation(prog, ATTR_VERTEX, "vertex");
+    glBindAttribLocation(prog, ATTR_POS, "inst_pos");
+    glBindAttribLocation(prog, ATTR_QUAT, "inst_quat");
+    glBindAttribLocation(prog, ATTR_WIDTH, "inst_width");
+    glBindAttribLocation(prog, ATTR_LENGTH, "inst_length");
+    glLinkProgram(prog);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    glGetProgramiv(prog, GL_LINK_STATUS, &ok);
+    if (!ok) {
+        char log[1024];
+        glGetProgramInfoLog(prog, sizeof(log), NULL, log);
+        fprintf(stderr, "Error al enlazar shader: %s\n", log);
+        glDeleteProgram(prog);
+        return 0;
+    }
+    return prog;
+}
+
+/*
+ * Mallas de todos los niveles en un solo par de buffers.  Cada cilindro
+ * unitario es un anillo en z = 0 y otro en z = 1.
+ */
+void TreeRenderer::build_mesh() {
+    std::vector<GLfloat> vertices;
+    std::vector<GLushort> indices;
+
+    for (int k = 0; k < LOD_LEVELS; k++) {
+        GLushort base = vertices.size() / 3;
+        LodMesh &m = lod_mesh[k];
+
+        m.offset = indices.size() * sizeof(GLushort);
+        if (k < LOD_CYLINDERS) {
+            int slices = LOD_SLICES[k];
+            for (int i = 0; i <= slices; i++) {
+                double a = 2.0 * PI * i / slices;
+                for (int z = 0; z < 2; z++) {
+                    vertices.push_back(sin(a));
+                    vertices.push_back(cos(a));
+                    vertices.push_back(z);
+                }
+            }
+            for (int i = 0; i < slices; i++) {
+                GLushort v = base + 2 * i;
+                GLushort quad[6] = {v, (GLushort)(v + 2), (GLushort)(v + 1),
+                                    (GLushort)(v + 1), (GLushort)(v + 2), (GLushort)(v + 3)};
+                indices.insert(indices.end(), quad, quad + 6);
+            }
+            m.mode = GL_TRIANGLES;
+            m.triangles = 2 * slices;
+        }
+        else if (k == LOD_LINES) {
+            GLfloat line[6] = {0, 1, 0, 0, 1, 1};
+            vertices.insert(vertices.end(), line, line + 6);
+            indices.push_back(base);
+            indices.push_back(base + 1);
+            m.mode = GL_LINES;
+            m.triangles = 0;
+        }
+        else {
+            GLfloat point[3] = {0, 1, 0.5};
+            vertices.insert(vertices.end(), point, point + 3);
+            indices.push_back(base);
+            m.mode = GL_POINTS;
+            m.triangles = 0;
+        }
+        m.count = indices.size() - m.offset / sizeof(GLushort);
+    }
+
+    glGenBuffers(1, &mesh_vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh_vbo);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(GLfloat), vertices.data(), GL_STATIC_DRAW);
+    glGenBuffers(1, &index_vbo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_vbo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLushort), indices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+void TreeRenderer::upload(const SegmentStore &lines) {
+    TRACE_SCOPE("subida");
+    source = &lines;
+    version = lines.version;
+    count = lines.size();
+    upload_count++;
+    bvh.build(lines, std::max<size_t>(BVH_LEAF_SIZE, count / CULL_MAX_LEAVES + 1));
+    if (!program) {
+        tessellate(lines);
+        return;
+    }
+
+    upload_instances(lines);
+}
+
+/* Sube las instancias en el orden de las hojas de la BVH */
+void TreeRenderer::upload_instances(const SegmentStore &lines) {
+    std::vector<float> pos(3 * count), width(count), length(count);
+    std::vector<short> q(4 * count);
+
+    for (size_t k = 0; k < count; k++) {
+        size_t i = bvh.order[k];
+        std::copy(&lines.pos[3*i], &lines.pos[3*i] + 3, &pos[3*k]);
+        std::copy(&lines.q[4*i], &lines.q[4*i] + 4, &q[4*k]);
+        width[k] = lines.width[i];
+        length[k] = lines.length[i];
+    }
+
+    /* Máximo largo desde cada instancia hasta el final de su hoja */
+    tail_length = length;
+    for (const BvhNode &node : bvh.nodes) {
+        if (node.right) continue;
+        for (size_t k = node.first + node.count - 1; k > node.first; k--)
+            tail_length[k - 1] = std::max(tail_length[k - 1], tail_length[k]);
+    }
+    sorted_width = width;
+
+    const void *data[4] = {pos.data(), q.data(), width.data(), length.data()};
+    size_t bytes[4] = {pos.size() * sizeof(float), q.size() * sizeof(short),
+                       width.size() * sizeof(float), length.size() * sizeof(float)};
+    for (int k = 0; k < 4; k++) {
+        glBindBuffer(GL_ARRAY_BUFFER, inst_vbo[k]);
+        glBufferData(GL_ARRAY_BUFFER, bytes[k], data[k], GL_STATIC_DRAW);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+/* Hojas que tocan el volumen de visión (todas si no hay recorte) */
+void TreeRenderer::cull() {
+    double MV[16], PR[16], planes[6][4];
+
+    TRACE_SCOPE("recorte");
+    leaves.clear();
+    if (culling) {
+        glGetDoublev(GL_MODELVIEW_MATRIX, MV);
+        glGetDoublev(GL_PROJECTION_MATRIX, PR);
+        frustum_planes(PR, MV, planes);
+        bvh.cull(planes, leaves, &cull_stats);
+        return;
+    }
+
+    for (uint32_t k = 0; k < bvh.nodes.size(); k++)
+        if (bvh.is_leaf(k))
+            leaves.push_back(k);
+    /* Los nodos no están en el orden de las instancias */
+    std::sort(leaves.begin(), leaves.end(), [&](uint32_t a, uint32_t b) {
+        return bvh.nodes[a].first < bvh.nodes[b].first;
+    });
+    cull_stats.nodes = bvh.nodes.size();
+    cull_stats.leaves = leaves.size();
+    cull_stats.segments = count;
+}
+
+/*
+ * Reparte las instancias de las hojas visibles entre los niveles según el
+ * tamaño en pantalla de los segmentos a la profundidad del centro de cada
+ * hoja.  Tramos contiguos del mismo nivel se juntan en uno.
+ */
+void TreeRenderer::select_lod() {
+    double MV[16], PR[16];
+    GLint vp[4];
+
+    TRACE_SCOPE("nivel_detalle");
+    draws.clear();
+    std::fill(lod_count, lod_count + LOD_LEVELS, 0);
+    glGetDoublev(GL_MODELVIEW_MATRIX, MV);
+    glGetDoublev(GL_PROJECTION_MATRIX, PR);
+    glGetIntegerv(GL_VIEWPORT, vp);
+
+    auto add = [&](int level, size_t first, size_t n) {
+        if (n == 0) return;
+        lod_count[level] += n;
+        if (!draws.empty() && draws.back().level == level &&
+            draws.back().first + draws.back().count == first) {
+            draws.back().count += n;
+            return;
+        }
+        LodDraw d = {level, first, n, 0};
+        draws.push_back(d);
+    };
+
+    for (uint32_t leaf : leaves) {
+        const BvhNode &node = bvh.nodes[leaf];
+        size_t bound[LOD_LEVELS + 1];
+        size_t end = node.first + node.count;
+
+        if (forced_lod >= 0) {
+            add(forced_lod, node.first, node.count);
+            continue;
+        }
+
+        /* Píxeles por unidad: en perspectiva dependen de la profundidad */
+        double px = PR[5] * vp[3] / 2.0;
+        if (PR[15] == 0.0) {
+            double c[3];
+            for (int d = 0; d < 3; d++)
+                c[d] = (node.lo[d] + node.hi[d]) / 2;
+            double depth = -(MV[2]*c[0] + MV[6]*c[1] + MV[10]*c[2] + MV[14]);
+            px = depth > 1e-6 ? px / depth : HUGE_VAL;
+        }
+
+        bound[0] = node.first;
+        for (int k = 0; k < LOD_CYLINDERS; k++) {
+            double min_width = LOD_MIN_PIXELS[k] / (2.0 * CYL_RADIUS * px);
+            bound[k + 1] = std::partition_point(sorted_width.begin() + bound[k], sorted_width.begin() + end,
+                [&](float w) { return w >= min_width; }) - sorted_width.begin();
+        }
+        bound[LOD_POINTS] = std::partition_point(tail_length.begin() + bound[LOD_LINES], tail_length.begin() + end,
+            [&](float l) { return l * px >= 1.0; }) - tail_length.begin();
+        bound[LOD_LEVELS] = end;
+
+        for (int k = 0; k < LOD_LEVELS; k++)
+            add(k, bound[k], bound[k + 1] - bound[k]);
+    }
+}
+
+/*
+ * Camino sin instancing: cada segmento es una tira de 2*(CYL_SLICES+1)
+ * vértices (normal y posición, GL_N3F_V3F) ya transformada con gl_matrix.
+ */
+void TreeRenderer::tessellate(const SegmentStore &lines) {
+    const int verts = 2 * (CYL_SLICES + 1);
+    std::vector<GLfloat> data;
+    double ring[CYL_SLICES + 1][2];
+
+    for (int j = 0; j <= CYL_SLICES; j++) {
+        double a = 2.0 * PI * j / CYL_SLICES;
+        ring[j][0] = sin(a);
+        ring[j][1] = cos(a);
+    }
+
+    /* Las tiras van en el orden de las hojas de la BVH */
+    data.reserve(lines.size() * verts * 6);
+    strip_first.resize(lines.size());
+    strip_count.assign(lines.size(), verts);
+    for (size_t s = 0; s < lines.size(); s++) {
+        size_t i = bvh.order[s];
+        double M[16];
+        double r0 = CYL_RADIUS * lines.width[i];
+        double len = lines.length[i];
+        double nz = len > 0 ? r0 * (1.0 - CYL_TAPER) / len : 0.0;
+        double nn = 1.0 / sqrt(1.0 + nz*nz);
+
+        lines.gl_matrix(i, M);
+        strip_first[s] = s * verts;
+        for (int j = 0; j <= CYL_SLICES; j++) {
+            for (int z = 0; z < 2; z++) {
+                double r = z ? r0 * CYL_TAPER : r0;
+                double n[3] = {ring[j][0] * nn, ring[j][1] * nn, nz * nn};
+                double v[3] = {ring[j][0] * r, ring[j][1] * r, z * len};
+                for (int k = 0; k < 3; k++)
+                    data.push_back(M[k] * n[0] + M[4 + k] * n[1] + M[8 + k] * n[2]);
+                for (int k = 0; k < 3; k++)
+                    data.push_back(M[k] * v[0] + M[4 + k] * v[1] + M[8 + k] * v[2] + M[12 + k]);
+            }
+        }
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, world_vbo);
+    glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(GLfloat), data.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void TreeRenderer::draw(const SegmentStore &lines) {
+    if (&lines != source || lines.version != version)
+        upload(lines);
+    if (count == 0) return;
+    cull();
+    if (!program) {
+        draw_legacy();
+        return;
+    }
+
+    select_lod();
+    draw_instances(NULL);
+}
+
+/* Dibuja los tramos de 'draws'; con corte, cada uno con su instancia */
+void TreeRenderer::draw_instances(const SubtreeLayout *layout) {
+    glUseProgram(layout ? shape_program : program);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh_vbo);
+    glEnableVertexAttribArray(ATTR_VERTEX);
+    glVertexAttribPointer(ATTR_VERTEX, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    for (int a = ATTR_POS; a <= ATTR_LENGTH; a++) {
+        glEnableVertexAttribArray(a);
+        glVertexAttribDivisor(a, 1);
+    }
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_vbo);
+
+    uint32_t current = (uint32_t)-1;
+
+    for (const LodDraw &d : draws) {
+        const LodMesh &m = lod_mesh[d.level];
+        size_t first = d.first;
+
+        if (layout && d.instance != current) {
+            const SubtreeInstance &inst = layout->instances[d.instance];
+            glUniform3fv(uniform_origin, 1, inst.P);
+            glUniform4fv(uniform_rotation, 1, inst.q);
+            glUniform2f(uniform_scale, inst.scale, inst.wscale);
+            current = d.instance;
+        }
+
+        /*
+         * Un arreglo por atributo, desde la primera instancia del tramo;
+         * la orientación va en snorm16.
+         */
+        glBindBuffer(GL_ARRAY_BUFFER, inst_vbo[0]);
+        glVertexAttribPointer(ATTR_POS, 3, GL_FLOAT, GL_FALSE, 0, (void *)(3 * sizeof(float) * first));
+        glBindBuffer(GL_ARRAY_BUFFER, inst_vbo[1]);
+        glVertexAttribPointer(ATTR_QUAT, 4, GL_SHORT, GL_TRUE, 0, (void *)(4 * sizeof(short) * first));
+        glBindBuffer(GL_ARRAY_BUFFER, inst_vbo[2]);
+        glVertexAttribPointer(ATTR_WIDTH, 1, GL_FLOAT, GL_FALSE, 0, (void *)(sizeof(float) * first));
+        glBindBuffer(GL_ARRAY_BUFFER, inst_vbo[3]);
+        glVertexAttribPointer(ATTR_LENGTH, 1, GL_FLOAT, GL_FALSE, 0, (void *)(sizeof(float) * first));
+
+        glDrawElementsInstanced(m.mode, m.count, GL_UNSIGNED_SHORT, (void *)m.offset, d.count);
+        TRACE_COUNT(TRACE_CYLINDERS, d.count);
+        TRACE_COUNT(TRACE_TRIANGLES, d.count * m.triangles);
+        TRACE_COUNT(TRACE_DRAW_CALLS, 1);
+    }
+
+    for (int a = ATTR_POS; a <= ATTR_LENGTH; a++) {
+        glVertexAttribDivisor(a, 0);
+        glDisableVertexAttribArray(a);
+    }
+    glDisableVertexAttribArray(ATTR_VERTEX);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glUseProgram(0);
+}
+
+/*
+ * Sube los segmentos locales del corte tal como vienen: cada forma ya
+ * está ordenada de mayor a menor grosor.
+ */
+void TreeRenderer::upload(const SubtreeLayout &layout) {
+    const SegmentStore &lines = layout.segments;
+
+    TRACE_SCOPE("subida");
+    source = &lines;
+    version = lines.version;
+    count = lines.size();
+    upload_count++;
+    bvh.clear();
+    if (!program)
+        return;
+
+    /* Máximo largo desde cada segmento hasta el final de su forma */
+    tail_length = lines.length;
+    for (const LayoutShape &ls : layout.shapes)
+        for (size_t k = ls.first + ls.count - 1; ls.count && k > ls.first; k--)
+            tail_length[k - 1] = std::max(tail_length[k - 1], tail_length[k]);
+    sorted_width = lines.width;
+
+    const void *data[4] = {lines.pos.data(), lines.q.data(), lines.width.data(), lines.length.data()};
+    size_t bytes[4] = {lines.pos.size() * sizeof(float), lines.q.size() * sizeof(short),
+                       lines.width.size() * sizeof(float), lines.length.size() * sizeof(float)};
+    for (int k = 0; k < 4; k++) {
+        glBindBuffer(GL_ARRAY_BUFFER, inst_vbo[k]);
+        glBufferData(GL_ARRAY_BUFFER, bytes[k], data[k], GL_STATIC_DRAW);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+/* Centro y radio en el mundo de la esfera de una instancia */
+static void instance_sphere(const SubtreeInstance &inst, const LayoutShape &ls, double c[3], double *r) {
+    double v[3] = {ls.center[0], ls.center[1], ls.center[2]};
+    const float *q = inst.q;
+    double t[3] = {q[1]*v[2] - q[2]*v[1] + q[3]*v[0],
+                   q[2]*v[0] - q[0]*v[2] + q[3]*v[1],
+                   q[0]*v[1] - q[1]*v[0] + q[3]*v[2]};
+    c[0] = inst.P[0] + inst.scale * (v[0] + 2.0 * (q[1]*t[2] - q[2]*t[1]));
+    c[1] = inst.P[1] + inst.scale * (v[1] + 2.0 * (q[2]*t[0] - q[0]*t[2]));
+    c[2] = inst.P[2] + inst.scale * (v[2] + 2.0 * (q[0]*t[1] - q[1]*t[0]));
+    *r = inst.scale * ls.radius + inst.wscale * ls.wradius;
+}
+
+/* Instancias cuya esfera toca el volumen de visión (todas si no hay recorte) */
+void TreeRenderer::cull_shapes(const SubtreeLayout &layout) {
+    double MV[16], PR[16], planes[6][4];
+
+    TRACE_SCOPE("recorte");
+    leaves.clear();
+    cull_stats.nodes = layout.instances.size();
+    cull_stats.segments = 0;
+    if (culling) {
+        glGetDoublev(GL_MODELVIEW_MATRIX, MV);
+        glGetDoublev(GL_PROJECTION_MATRIX, PR);
+        frustum_planes(PR, MV, planes);
+        for (int p = 0; p < 6; p++) {
+            double n = sqrt(planes[p][0]*planes[p][0] + planes[p][1]*planes[p][1] +
+                            planes[p][2]*planes[p][2]);
+            for (int k = 0; k < 4; k++)
+                planes[p][k] /= n;
+        }
+    }
+
+    for (uint32_t i = 0; i < layout.instances.size(); i++) {
+        const SubtreeInstance &inst = layout.instances[i];
+        const LayoutShape &ls = layout.shapes[inst.shape];
+        bool outside = ls.count == 0;
+
+        if (culling) {
+            double c[3], r;
+            instance_sphere(inst, ls, c, &r);
+            for (int p = 0; p < 6 && !outside; p++)
+                outside = planes[p][0]*c[0] + planes[p][1]*c[1] + planes[p][2]*c[2] + planes[p][3] < -r;
+        }
+        if (outside)
+            continue;
+        leaves.push_back(i);
+        cull_stats.segments += ls.count;
+    }
+    cull_stats.leaves = leaves.size();
+}
+
+/*
+ * Como select_lod, por instancia: los píxeles por unidad se toman en el
+ * centro de su esfera y los grosores y largos se escalan con ella.
+ */
+void TreeRenderer::select_shape_lod(const SubtreeLayout &layout) {
+    double MV[16], PR[16];
+    GLint vp[4];
+
+    TRACE_SCOPE("nivel_detalle");
+    draws.clear();
+    std::fill(lod_count, lod_count + LOD_LEVELS, 0);
+    glGetDoublev(GL_MODELVIEW_MATRIX, MV);
+    glGetDoublev(GL_PROJECTION_MATRIX, PR);
+    glGetIntegerv(GL_VIEWPORT, vp);
+
+    for (uint32_t i : leaves) {
+        const SubtreeInstance &inst = layout.instances[i];
+        const LayoutShape &ls = layout.shapes[inst.shape];
+        size_t bound[LOD_LEVELS + 1];
+        size_t end = ls.first + ls.count;
+
+        if (forced_lod >= 0) {
+            LodDraw d = {forced_lod, ls.first, ls.count, i};
+            draws.push_back(d);
+            lod_count[forced_lod] += ls.count;
+            continue;
+        }
+
+        double px = PR[5] * vp[3] / 2.0;
+        if (PR[15] == 0.0) {
+            double c[3], r;
+            instance_sphere(inst, ls, c, &r);
+            double depth = -(MV[2]*c[0] + MV[6]*c[1] + MV[10]*c[2] + MV[14]);
+            px = depth > 1e-6 ? px / depth : HUGE_VAL;
+        }
+
+        bound[0] = ls.first;
+        for (int k = 0; k < LOD_CYLINDERS; k++) {
+            double min_width = LOD_MIN_PIXELS[k] / (2.0 * CYL_RADIUS * px * inst.wscale);
+            bound[k + 1] = std::partition_point(sorted_width.begin() + bound[k], sorted_width.begin() + end,
+                [&](float w) { return w >= min_width; }) - sorted_width.begin();
+        }
+        bound[LOD_POINTS] = std::partition_point(tail_length.begin() + bound[LOD_LINES], tail_length.begin() + end,
+            [&](float l) { return l * inst.scale * px >= 1.0; }) - tail_length.begin();
+        bound[LOD_LEVELS] = end;
+
+        for (int k = 0; k < LOD_LEVELS; k++) {
+            if (bound[k + 1] == bound[k]) continue;
+            LodDraw d = {k, bound[k], bound[k + 1] - bound[k], i};
+            draws.push_back(d);
+            lod_count[k] += d.count;
+        }
+    }
+}
+
+void TreeRenderer::draw(const SubtreeLayout &layout) {
+    if (&layout.segments != source || layout.segments.version != version)
+        upload(layout);
+    if (!shape_program || count == 0) return;
+    cull_shapes(layout);
+    select_shape_lod(layout);
+    draw_instances(&layout);
+}
+
+void TreeRenderer::draw_legacy() {
+    glBindBuffer(GL_ARRAY_BUFFER, world_vbo);
+    glInterleavedArrays(GL_N3F_V3F, 0, 0);
+    /* Las hojas contiguas se dibujan con una sola llamada */
+    for (size_t j = 0; j < leaves.size(); ) {
+        size_t first = bvh.nodes[leaves[j]].first, end = first;
+        while (j < leaves.size() && bvh.nodes[leaves[j]].first == end)
+            end += bvh.nodes[leaves[j++]].count;
+        glMultiDrawArrays(GL_TRIANGLE_STRIP, &strip_first[first], &strip_count[first], end - first);
+        TRACE_COUNT(TRACE_CYLINDERS, end - first);
+        TRACE_COUNT(TRACE_TRIANGLES, (end - first) * 2 * CYL_SLICES);
+        TRACE_COUNT(TRACE_DRAW_CALLS, 1);
+    }
+    glDisableClientState(GL_NORMAL_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+size_t TreeRenderer::triangles() const {
+    size_t n = 0;
+
+    if (!program)
+        return visible() * 2 * CYL_SLICES;
+    for (int k = 0; k < LOD_LEVELS; k++)
+        n += lod_instances(k) * lod_mesh[k].triangles;
+    return n;
+}
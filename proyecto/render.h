@@ -0,0 +1,155 @@
+/**
+ * L-systems: dibujo de los segmentos del árbol.
+ *
+ * Con instancing, una llamada instanciada por nivel de detalle sobre la
+ * malla de un cilindro unitario, con los arreglos de SegmentStore como
+ * VBOs; sin él, cilindros teselados en un solo VBO.  El shader replica la
+ * iluminación del pipeline fijo, así que se ve igual que con gluCylinder.
+ */
+#ifndef RENDER_H
+#define RENDER_H
+
+#include <vector>
+#include <GL/glew.h>
+#include "segments.h"
+#include "bvh.h"
+#include "subtree.h"
+
+/* Divisiones del cilindro, como en el gluCylinder original */
+#define CYL_SLICES      30
+
+/*
+ * Niveles de detalle (solo con instancing): cilindros de 30, 16, 8 y 4
+ * lados (el último de una sola franja, recto), líneas para los segmentos
+ * de menos de un píxel de ancho y puntos para los que además miden menos
+ * de un píxel de largo.  Los píxeles se miden a la profundidad del centro
+ * de cada hoja de la BVH.
+ */
+#define LOD_LEVELS      6
+#define LOD_CYLINDERS   4
+#define LOD_LINES       4
+#define LOD_POINTS      5
+
+/*
+ * Hojas de la BVH como máximo: en árboles grandes las hojas crecen para
+ * que las llamadas de dibujo por cuadro sigan acotadas.
+ */
+#define CULL_MAX_LEAVES 2048
+
+/* Malla de un nivel dentro de mesh_vbo/index_vbo */
+typedef struct {
+    GLenum mode;
+    GLsizei count;          /* índices */
+    size_t offset;          /* en bytes, dentro de index_vbo */
+    GLsizei triangles;
+} LodMesh;
+
+/* Tramo de instancias que se dibuja con un mismo nivel */
+typedef struct {
+    int level;
+    size_t first;
+    size_t count;
+    uint32_t instance;      /* instancia del corte (0 con los segmentos planos) */
+} LodDraw;
+
+class TreeRenderer {
+public:
+    TreeRenderer();
+
+    /*
+     * Requiere un contexto de OpenGL activo (después de glewInit).
+     * Devuelve false si se usará el camino sin instancing (porque el
+     * contexto no lo soporta o porque use_instancing es false).
+     */
+    bool init(bool use_instancing = true);
+    void release();
+    /*
+     * Dibuja los segmentos con la matriz de modelo-vista y el color
+     * actuales.  Solo los sube a la GPU si cambiaron desde la última vez
+     * (SegmentStore::version).
+     *
+     * Al subirlos se construye una BVH (bvh.h) y los segmentos van en el
+     * orden de sus hojas, cada hoja de mayor a menor grosor.  En cada
+     * cuadro solo se dibujan las hojas que tocan el volumen de visión, y
+     * cada nivel de detalle de una hoja es un tramo contiguo que se busca
+     * con una búsqueda binaria.
+     */
+    void draw(const SegmentStore &lines);
+    /* Sube los segmentos aunque su versión no haya cambiado */
+    void upload(const SegmentStore &lines);
+    /*
+     * Lo mismo con un corte de subárboles instanciados (subtree.h; no
+     * dibuja sin instancing).  Cada forma se sube una vez en espacio local
+     * y cada instancia pasa su transformación como uniforms; el recorte y
+     * el nivel de detalle se hacen por instancia con la esfera envolvente
+     * de su forma.
+     */
+    void draw(const SubtreeLayout &layout);
+    void upload(const SubtreeLayout &layout);
+
+    /* Fija un nivel para todos los segmentos, o -1 para elegirlo por tamaño */
+    void set_lod(int level) { forced_lod = level; }
+    /* Activa o desactiva el recorte contra el volumen de visión */
+    void set_culling(bool on) { culling = on; }
+
+    bool instanced() const { return program != 0; }
+    /* Triángulos, instancias por nivel y segmentos visibles del último cuadro */
+    size_t triangles() const;
+    size_t lod_instances(int level) const { return lod_count[level]; }
+    size_t visible() const { return cull_stats.segments; }
+    /* Cantidad de veces que se subió geometría */
+    unsigned long uploads() const { return upload_count; }
+
+private:
+    GLuint build_program(bool shapes);
+    void build_mesh();
+    void upload_instances(const SegmentStore &lines);
+    void cull();
+    void select_lod();
+    void cull_shapes(const SubtreeLayout &layout);
+    void select_shape_lod(const SubtreeLayout &layout);
+    void draw_instances(const SubtreeLayout *layout);
+    void tessellate(const SegmentStore &lines);
+    void draw_legacy();
+
+    GLuint program;
+    GLuint shape_program;
+    GLuint mesh_vbo;
+    GLuint index_vbo;
+    GLuint inst_vbo[4];         /* pos, q, width, length */
+    /* Transformación de la instancia: origin, rotation y scale (largo, grosor) */
+    GLint uniform_origin, uniform_rotation, uniform_scale;
+    LodMesh lod_mesh[LOD_LEVELS];
+    size_t count;
+
+    /* BVH de los segmentos; las instancias van en el orden bvh.order */
+    SegmentBvh bvh;
+    bool culling;
+    /* Hojas (o instancias del corte) visibles del cuadro actual */
+    std::vector<uint32_t> leaves;
+    CullStats cull_stats;
+
+    /*
+     * Datos para elegir el nivel: grosores en el orden de las instancias
+     * (decreciente dentro de cada hoja) y máximo largo desde cada
+     * instancia hasta el final de su hoja.
+     */
+    std::vector<float> sorted_width;
+    std::vector<float> tail_length;
+    int forced_lod;
+    /* Tramos a dibujar en el cuadro actual e instancias por nivel */
+    std::vector<LodDraw> draws;
+    size_t lod_count[LOD_LEVELS];
+
+    /* Segmentos y versión presentes en la GPU (los del corte, si hay uno) */
+    const SegmentStore *source;
+    unsigned long version;
+    unsigned long upload_count;
+
+    /* Camino sin instancing: una tira de triángulos por segmento */
+    GLuint world_vbo;
+    std::vector<GLint> strip_first;
+    std::vector<GLsizei> strip_count;
+};
+
+#endif
@@ -0,0 +1,861 @@
+/**
+ * L-systems paramétricos: motor de reescritura.
+ * Basado en el libro de A. Lindenmayer "The Algorithmic Beauty of Plants"
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <cctype>
+#include <utility>
+#include "rewrite.h"
+
+/* Instrucciones de las expresiones */
+enum {
+    E_CONST, E_PARAM, E_NEG,
+    E_ADD, E_SUB, E_MUL, E_DIV, E_POW,
+    E_LT, E_GT, E_LE, E_GE, E_EQ, E_NE
+};
+
+static double apply_op(unsigned char op, double a, double b) {
+    switch (op) {
+        case E_ADD: return a + b;
+        case E_SUB: return a - b;
+        case E_MUL: return a * b;
+        case E_DIV: return a / b;
+        case E_POW: return pow(a, b);
+        case E_LT:  return a < b;
+        case E_GT:  return a > b;
+        case E_LE:  return a <= b;
+        case E_GE:  return a >= b;
+        case E_EQ:  return a == b;
+        case E_NE:  return a != b;
+        default:    return 0.0;
+    }
+}
+
+static void skip_spaces(const char *&s, const char *end) {
+    while (s < end && isspace((unsigned char)*s))
+        s++;
+}
+
+static bool is_ident_start(char c) {
+    return isalpha((unsigned char)c) || c == '_';
+}
+
+static bool is_ident_char(char c) {
+    return isalnum((unsigned char)c) || c == '_';
+}
+
+static std::string trim(const std::string &str) {
+    size_t b = str.find_first_not_of(" \t\r\n");
+    size_t e = str.find_last_not_of(" \t\r\n");
+    return b == std::string::npos ? "" : str.substr(b, e - b + 1);
+}
+
+/*
+ * Compilador de expresiones por descenso recursivo.  Genera código en
+ * notación polaca inversa y pliega las operaciones entre constantes, de
+ * modo que "l*r1" queda como PARAM(l) CONST(r1) MUL.
+ */
+struct ExprParser {
+    const char *s, *end;
+    const std::vector<std::string> *formals;
+    const std::vector<std::string> *names;
+    const std::vector<double> *values;
+    std::vector<Instr> *code;
+    int depth, max_depth;
+    std::string error;
+
+    void push(unsigned char op, unsigned char index, double value) {
+        Instr in = {op, index, value};
+        code->push_back(in);
+        if (++depth > max_depth) max_depth = depth;
+    }
+
+    void binary(unsigned char op) {
+        size_t n = code->size();
+        depth--;
+        if (n >= 2 && (*code)[n-1].op == E_CONST && (*code)[n-2].op == E_CONST) {
+            (*code)[n-2].value = apply_op(op, (*code)[n-2].value, (*code)[n-1].value);
+            code->pop_back();
+            return;
+        }
+        Instr in = {op, 0, 0.0};
+        code->push_back(in);
+    }
+
+    void negate() {
+        if (!code->empty() && code->back().op == E_CONST) {
+            code->back().value = -code->back().value;
+            return;
+        }
+        Instr in = {E_NEG, 0, 0.0};
+        code->push_back(in);
+    }
+
+    bool accept(const char *tok) {
+        size_t n = strlen(tok);
+        skip_spaces(s, end);
+        if ((size_t)(end - s) >= n && strncmp(s, tok, n) == 0) {
+            s += n;
+            return true;
+        }
+        return false;
+    }
+
+    bool fail(const std::string &msg) {
+        if (error.empty()) error = msg;
+        return false;
+    }
+
+    bool primary() {
+        skip_spaces(s, end);
+        if (s >= end) return fail("expresión incompleta");
+
+        if (*s == '(') {
+            s++;
+            if (!comparison()) return false;
+            if (!accept(")")) return fail("falta ')' en la expresión");
+            return true;
+        }
+        if (isdigit((unsigned char)*s) || *s == '.') {
+            char *stop;
+            double v = strtod(s, &stop);
+            s = stop;
+            push(E_CONST, 0, v);
+            return true;
+        }
+        if (is_ident_start(*s)) {
+            const char *b = s;
+            while (s < end && is_ident_char(*s)) s++;
+            std::string name(b, s);
+
+            for (size_t i = 0; i < formals->size(); i++)
+                if ((*formals)[i] == name) {
+                    push(E_PARAM, (unsigned char)i, 0.0);
+                    return true;
+                }
+            for (size_t i = names->size(); i-- > 0; )
+                if ((*names)[i] == name) {
+                    push(E_CONST, 0, (*values)[i]);
+                    return true;
+                }
+            return fail("nombre desconocido '" + name + "'");
+        }
+        return fail(std::string("símbolo inesperado '") + *s + "' en la expresión");
+    }
+
+    bool power() {
+        if (!primary()) return false;
+        if (accept("^")) {
+            if (!unary()) return false;
+            binary(E_POW);
+        }
+        return true;
+    }
+
+    bool unary() {
+        if (accept("-")) {
+            if (!unary()) return false;
+            negate();
+            return true;
+        }
+        if (accept("+"))
+            return unary();
+        return power();
+    }
+
+    bool term() {
+        if (!unary()) return false;
+        for (;;) {
+            if (accept("*")) { if (!unary()) return false; binary(E_MUL); }
+            else if (accept("/")) { if (!unary()) return false; binary(E_DIV); }
+            else return true;
+        }
+    }
+
+    bool sum() {
+        if (!term()) return false;
+        for (;;) {
+            if (accept("+")) { if (!term()) return false; binary(E_ADD); }
+            else if (accept("-")) { if (!term()) return false; binary(E_SUB); }
+            else return true;
+        }
+    }
+
+    bool comparison() {
+        static const struct { const char *tok; unsigned char op; } OPS[] = {
+            {"<=", E_LE}, {">=", E_GE}, {"==", E_EQ}, {"!=", E_NE},
+            {"<", E_LT}, {">", E_GT}
+        };
+        if (!sum()) return false;
+        for (const auto &o : OPS)
+            if (accept(o.tok)) {
+                if (!sum()) return false;
+                binary(o.op);
+                break;
+            }
+        return true;
+    }
+};
+
+LSystem::LSystem() : iterations(0), stochastic(false), context_sensitive(false) {
+    memset(ignore, 0, sizeof(ignore));
+}
+
+bool LSystem::fail(const std::string &msg) {
+    error = msg;
+    return false;
+}
+
+/*
+ * Compila la expresión que comienza en 's' y termina antes de una ',' o
+ * ')' de primer nivel (o del final del texto).
+ */
+bool LSystem::compile(const char *&s, const char *end,
+                      const std::vector<std::string> &formals, Expr *e) {
+    ExprParser p;
+    p.s = s;
+    p.end = end;
+    p.formals = &formals;
+    p.names = &const_names;
+    p.values = &const_values;
+    p.code = &code;
+    p.depth = p.max_depth = 0;
+
+    e->begin = code.size();
+    if (!p.comparison())
+        return fail(p.error);
+    if (p.max_depth > MAX_EXPR_STACK)
+        return fail("expresión demasiado compleja");
+    e->end = code.size();
+    s = p.s;
+    skip_spaces(s, end);
+    return true;
+}
+
+double LSystem::eval(const Expr &e, const double *args) const {
+    double st[MAX_EXPR_STACK];
+    int sp = 0;
+
+    for (unsigned int i = e.begin; i < e.end; i++) {
+        const Instr &in = code[i];
+        switch (in.op) {
+            case E_CONST: st[sp++] = in.value; break;
+            case E_PARAM: st[sp++] = args[in.index]; break;
+            case E_NEG:   st[sp-1] = -st[sp-1]; break;
+            default:
+                sp--;
+                st[sp-1] = apply_op(in.op, st[sp-1], st[sp]);
+                break;
+        }
+    }
+    return st[0];
+}
+
+bool LSystem::define(const std::string &name, double value) {
+    if (name.empty() || !is_ident_start(name[0]))
+        return fail("nombre de constante inválido '" + name + "'");
+    const_names.push_back(name);
+    const_values.push_back(value);
+    return true;
+}
+
+bool LSystem::set_axiom(const std::string &text) {
+    std::vector<std::string> none;
+    const char *s = text.data(), *end = s + text.size();
+
+    axiom.clear();
+    skip_spaces(s, end);
+    while (s < end) {
+        Module m = {*s++, 0, (unsigned int)axiom.params.size()};
+        if (m.sym == '(' || m.sym == ')' || m.sym == ',')
+            return fail("axioma mal formado");
+
+        skip_spaces(s, end);
+        if (s < end && *s == '(') {
+            s++;
+            do {
+                Expr e;
+                size_t mark = code.size();
+                if (m.nparams == MAX_PARAMS)
+                    return fail("demasiados parámetros en el axioma");
+                if (!compile(s, end, none, &e)) return false;
+                axiom.params.push_back(eval(e, NULL));
+                code.resize(mark);
+                m.nparams++;
+            } while (s < end && *s++ == ',');
+            if (s[-1] != ')') return fail("falta ')' en el axioma");
+        }
+        axiom.modules.push_back(m);
+        skip_spaces(s, end);
+    }
+    return true;
+}
+
+/*
+ * Lee una secuencia de módulos con sus parámetros formales, como
+ * "A(x)B(y,z)C", y agrega los nombres de los formales a 'formals'.
+ */
+bool LSystem::parse_modules(const std::string &text, std::vector<CtxModule> &out,
+                            std::vector<std::string> &formals) {
+    const char *s = text.data(), *end = s + text.size();
+
+    skip_spaces(s, end);
+    while (s < end) {
+        CtxModule m = {*s++, 0};
+        if (m.sym == '(' || m.sym == ')' || m.sym == ',')
+            return fail("módulo mal formado en '" + text + "'");
+
+        skip_spaces(s, end);
+        if (s < end && *s == '(') {
+            s++;
+            for (;;) {
+                skip_spaces(s, end);
+                const char *b = s;
+                while (s < end && is_ident_char(*s)) s++;
+                if (b == s) return fail("parámetro formal inválido en '" + text + "'");
+                formals.push_back(std::string(b, s));
+                m.nparams++;
+                skip_spaces(s, end);
+                if (s < end && *s == ',') { s++; continue; }
+                if (s < end && *s == ')') { s++; break; }
+                return fail("falta ')' en '" + text + "'");
+            }
+        }
+        if (formals.size() > MAX_PARAMS)
+            return fail("demasiados parámetros en '" + text + "'");
+        out.push_back(m);
+        skip_spaces(s, end);
+    }
+    return true;
+}
+
+/*
+ * Agrega una producción
+ *   "[pN:] [izq <] A(x,y) [> der] [: condición] -> sucesor [: peso]"
+ * La condición '*' (o ausente) se cumple siempre.
+ */
+bool LSystem::add_production(const std::string &rule) {
+    std::vector<std::string> formals;
+    std::vector<CtxModule> left_ctx, pred, right_ctx;
+    Production p;
+    std::string text = trim(rule);
+
+    /* Etiqueta opcional pN: */
+    if (text.size() > 1 && text[0] == 'p' && isdigit((unsigned char)text[1])) {
+        size_t i = 1;
+        while (i < text.size() && isdigit((unsigned char)text[i])) i++;
+        size_t colon = text.find_first_not_of(" \t", i);
+        if (colon != std::string::npos && text[colon] == ':')
+            text = trim(text.substr(colon + 1));
+    }
+
+    size_t arrow = text.find("->");
+    if (arrow == std::string::npos)
+        return fail("falta '->' en la producción");
+    std::string left = text.substr(0, arrow);
+    std::string right = text.substr(arrow + 2);
+
+    std::string cond;
+    size_t colon = left.find(':');
+    if (colon != std::string::npos) {
+        cond = trim(left.substr(colon + 1));
+        left = left.substr(0, colon);
+    }
+
+    /* Peso de una producción estocástica */
+    p.prob = 0.0;
+    colon = right.rfind(':');
+    if (colon != std::string::npos) {
+        std::vector<std::string> none;
+        std::string weight = right.substr(colon + 1);
+        const char *w = weight.data(), *wend = w + weight.size();
+        Expr e;
+        size_t mark = code.size();
+
+        right = right.substr(0, colon);
+        if (!compile(w, wend, none, &e)) return false;
+        p.prob = eval(e, NULL);
+        code.resize(mark);
+        if (w != wend || !(p.prob > 0.0))
+            return fail("peso inválido en '" + rule + "'");
+    }
+
+    /* Contextos: '<' y '>' fuera de los paréntesis */
+    std::string lc, rc;
+    int depth = 0;
+    for (size_t i = 0; i < left.size(); i++) {
+        char c = left[i];
+        if (c == '(') depth++;
+        else if (c == ')') depth--;
+        else if (depth == 0 && c == '<' && lc.empty() && i > 0) {
+            lc = left.substr(0, i);
+            left.erase(0, i + 1);
+            i = (size_t)-1;
+        }
+        else if (depth == 0 && c == '>' && i > 0) {
+            rc = left.substr(i + 1);
+            left.erase(i);
+            break;
+        }
+    }
+    left = trim(left);
+    if (left.empty())
+        return fail("producción sin predecesor");
+
+    /* Formales: contexto izquierdo, predecesor y contexto derecho */
+    if (!parse_modules(lc, left_ctx, formals)) return false;
+    p.lparams = (unsigned char)formals.size();
+    if (!parse_modules(left, pred, formals)) return false;
+    if (pred.size() != 1)
+        return fail("el predecesor debe ser un solo módulo: '" + left + "'");
+    if (!parse_modules(rc, right_ctx, formals)) return false;
+    p.pred = pred[0].sym;
+    p.nparams = pred[0].nparams;
+
+    p.left_begin = contexts.size();
+    contexts.insert(contexts.end(), left_ctx.begin(), left_ctx.end());
+    p.left_end = p.right_begin = contexts.size();
+    contexts.insert(contexts.end(), right_ctx.begin(), right_ctx.end());
+    p.right_end = contexts.size();
+
+    /* Condición */
+    p.cond = -1;
+    if (!cond.empty() && cond != "*") {
+        Expr e;
+        const char *c = cond.data();
+        if (!compile(c, cond.data() + cond.size(), formals, &e)) return false;
+        p.cond = exprs.size();
+        exprs.push_back(e);
+    }
+
+    /* Sucesor */
+    const char *s = right.data(), *end = s + right.size();
+    p.succ_begin = successors.size();
+    skip_spaces(s, end);
+    while (s < end) {
+        SuccModule m = {*s++, 0, (unsigned int)exprs.size()};
+        if (m.sym == '(' || m.sym == ')' || m.sym == ',')
+            return fail("sucesor mal formado en '" + rule + "'");
+
+        skip_spaces(s, end);
+        if (s < end && *s == '(') {
+            std::vector<Expr> args;
+            s++;
+            do {
+                Expr e;
+                if (args.size() == MAX_PARAMS)
+                    return fail("demasiados parámetros en el sucesor");
+                if (!compile(s, end, formals, &e)) return false;
+                args.push_back(e);
+            } while (s < end && *s++ == ',');
+            if (s[-1] != ')') return fail("falta ')' en el sucesor '" + rule + "'");
+            m.nparams = (unsigned char)args.size();
+            exprs.insert(exprs.end(), args.begin(), args.end());
+        }
+        successors.push_back(m);
+        skip_spaces(s, end);
+    }
+    p.succ_end = successors.size();
+
+    /* Las sensibles al contexto van antes que las demás del mismo símbolo */
+    std::vector<unsigned int> &list = by_symbol[(unsigned char)p.pred];
+    std::vector<unsigned int>::iterator at = list.end();
+    if (p.left_begin != p.right_end) {
+        context_sensitive = true;
+        at = list.begin();
+        while (at != list.end() && productions[*at].left_begin != productions[*at].right_end)
+            ++at;
+    }
+    if (p.prob > 0.0)
+        stochastic = true;
+    list.insert(at, productions.size());
+    productions.push_back(p);
+    return true;
+}
+
+/*
+ * ¿Se aplica p al módulo i?  Sin contexto, los parámetros del módulo son
+ * los formales; con contexto se copian a 'buf' junto con los de los
+ * módulos vecinos que calzan.
+ */
+bool LSystem::applies(const Production &p, unsigned char nparams, const double *args,
+                      const ModuleString *str, const ContextIndex *ctx, size_t i,
+                      const double *&out, double *buf) const {
+    if (p.nparams != nparams) return false;
+
+    if (p.left_begin != p.right_end) {
+        if (!str) return false;
+
+        /* Contexto izquierdo, del último módulo al primero */
+        int j = (int)i;
+        unsigned int pos = p.lparams;
+        for (unsigned int k = p.left_end; k-- > p.left_begin; ) {
+            j = ctx->left[j];
+            if (j < 0) return false;
+            const Module &m = str->modules[j];
+            if (m.sym != contexts[k].sym || m.nparams != contexts[k].nparams) return false;
+            pos -= m.nparams;
+            memcpy(buf + pos, str->params.data() + m.param, m.nparams * sizeof(double));
+        }
+        memcpy(buf + p.lparams, args, nparams * sizeof(double));
+
+        j = (int)i;
+        pos = p.lparams + nparams;
+        for (unsigned int k = p.right_begin; k < p.right_end; k++) {
+            j = ctx->right[j];
+            if (j < 0) return false;
+            const Module &m = str->modules[j];
+            if (m.sym != contexts[k].sym || m.nparams != contexts[k].nparams) return false;
+            memcpy(buf + pos, str->params.data() + m.param, m.nparams * sizeof(double));
+            pos += m.nparams;
+        }
+        args = buf;
+    }
+
+    if (p.cond >= 0 && eval(exprs[p.cond], args) == 0.0) return false;
+    out = args;
+    return true;
+}
+
+/*
+ * Si la primera producción aplicable es determinista, es la elegida.  Si
+ * es estocástica, se suman los pesos de todas las estocásticas aplicables
+ * y una segunda pasada elige según key_unit(key).
+ */
+const Production *LSystem::select(char sym, unsigned char nparams, const double *args,
+                                  uint64_t key, const ModuleString *str,
+                                  const ContextIndex *ctx, size_t i,
+                                  const double *&out, double *buf) const {
+    const std::vector<unsigned int> &list = by_symbol[(unsigned char)sym];
+    size_t first = list.size();
+    double total = 0.0;
+
+    for (size_t k = 0; k < list.size(); k++) {
+        const Production &p = productions[list[k]];
+        if (first < list.size() && p.prob == 0.0) continue;
+        if (!applies(p, nparams, args, str, ctx, i, out, buf)) continue;
+        if (p.prob == 0.0) return &p;
+        if (first == list.size()) first = k;
+        total += p.prob;
+    }
+    if (first == list.size())
+        return NULL;
+
+    double t = key_unit(key) * total;
+    const Production *last = NULL;
+    for (size_t k = first; k < list.size(); k++) {
+        const Production &p = productions[list[k]];
+        if (p.prob == 0.0 || !applies(p, nparams, args, str, ctx, i, out, buf)) continue;
+        last = &p;
+        t -= p.prob;
+        if (t < 0.0) break;
+    }
+    return last;
+}
+
+const Production *LSystem::match(char sym, unsigned char nparams, const double *args,
+                                 uint64_t key) const {
+    const double *out;
+
+    /* Gramática determinista y sin contextos: la primera que se aplica */
+    if (!stochastic && !context_sensitive) {
+        for (unsigned int i : by_symbol[(unsigned char)sym]) {
+            const Production &p = productions[i];
+            if (p.nparams != nparams) continue;
+            if (p.cond >= 0 && eval(exprs[p.cond], args) == 0.0) continue;
+            return &p;
+        }
+        return NULL;
+    }
+    return select(sym, nparams, args, key, NULL, NULL, 0, out, NULL);
+}
+
+const Production *LSystem::match(const ModuleString &str, const ContextIndex &ctx, size_t i,
+                                 uint64_t key, const double *&args, double *buf) const {
+    const Module &m = str.modules[i];
+    return select(m.sym, m.nparams, str.params.data() + m.param, key, &str, &ctx, i, args, buf);
+}
+
+void ContextIndex::build(const ModuleString &str, const bool ignore[256]) {
+    size_t n = str.modules.size();
+    std::vector<int> open;
+    int last = -1;
+
+    left.resize(n);
+    right.resize(n);
+
+    /* Hacia la raíz: un '[' guarda el vecino y su ']' lo restituye */
+    for (size_t i = 0; i < n; i++) {
+        char c = str.modules[i].sym;
+        left[i] = c == '[' || c == ']' ? -1 : last;
+        if (c == '[')
+            open.push_back(last);
+        else if (c == ']') {
+            if (!open.empty()) {
+                last = open.back();
+                open.pop_back();
+            }
+        }
+        else if (!ignore[(unsigned char)c])
+            last = (int)i;
+    }
+
+    /* En la misma rama: de atrás hacia adelante se entra a las ramas por ']' */
+    open.clear();
+    last = -1;
+    for (size_t i = n; i-- > 0; ) {
+        char c = str.modules[i].sym;
+        right[i] = c == '[' || c == ']' ? -1 : last;
+        if (c == ']') {
+            open.push_back(last);
+            last = -1;
+        }
+        else if (c == '[') {
+            if (!open.empty()) {
+                last = open.back();
+                open.pop_back();
+            }
+        }
+        else if (!ignore[(unsigned char)c])
+            last = (int)i;
+    }
+}
+
+/*
+ * Lee una gramática línea por línea:
+ *   #define nombre expresión
+ *   #ignore: símbolos
+ *   n: iteraciones
+ *   w: axioma
+ *   [pN:] producción
+ * Los comentarios (de C o de C++) se ignoran.
+ */
+bool LSystem::parse(const std::string &text) {
+    size_t pos = 0;
+    int lineno = 0;
+
+    while (pos <= text.size()) {
+        size_t nl = text.find('\n', pos);
+        if (nl == std::string::npos) nl = text.size();
+        std::string line = text.substr(pos, nl - pos);
+        pos = nl + 1;
+        lineno++;
+
+        size_t c;
+        while ((c = line.find("/*")) != std::string::npos) {
+            size_t e = line.find("*/", c + 2);
+            line.erase(c, e == std::string::npos ? std::string::npos : e + 2 - c);
+        }
+        if ((c = line.find("//")) != std::string::npos)
+            line.erase(c);
+        line = trim(line);
+        if (line.empty()) continue;
+
+        bool ok;
+        if (line.compare(0, 7, "#define") == 0) {
+            std::vector<std::string> none;
+            const char *s = line.data() + 7, *end = line.data() + line.size();
+            skip_spaces(s, end);
+            const char *b = s;
+            while (s < end && is_ident_char(*s)) s++;
+            std::string name(b, s);
+
+            Expr e;
+            size_t mark = code.size();
+            ok = compile(s, end, none, &e) && define(name, eval(e, NULL));
+            code.resize(mark);
+        }
+        else if (line.compare(0, 7, "#ignore") == 0) {
+            for (size_t i = 7; i < line.size(); i++)
+                if (line[i] != ':' && !isspace((unsigned char)line[i]))
+                    ignore[(unsigned char)line[i]] = true;
+            ok = true;
+        }
+        else if (line.find("->") != std::string::npos)
+            ok = add_production(line);
+        else if (line.compare(0, 2, "n:") == 0) {
+            iterations = atoi(line.c_str() + 2);
+            ok = true;
+        }
+        else if (line.compare(0, 2, "w:") == 0)
+            ok = set_axiom(line.substr(2));
+        else
+            ok = fail("línea no reconocida");
+
+        if (!ok) {
+            error = "línea " + std::to_string(lineno) + ": " + error;
+            return false;
+        }
+    }
+    return true;
+}
+
+const ModuleString &Derivation::run(const LSystem &g, int n, uint64_t seed) {
+    ModuleString *cur = &buf[0], *next = &buf[1];
+    std::vector<uint64_t> *kcur = &keys[0], *knext = &keys[1];
+    double ctx_args[MAX_PARAMS];
+
+    *cur = g.axiom;
+    kcur->clear();
+    if (g.stochastic)
+        for (size_t j = 0; j < cur->modules.size(); j++)
+            kcur->push_back(axiom_key(seed, j));
+
+    for (int i = 0; i < n; i++) {
+        next->clear();
+        knext->clear();
+        if (g.context_sensitive)
+            ctx.build(*cur, g.ignore);
+        const double *params = cur->params.data();
+
+        for (size_t j = 0; j < cur->modules.size(); j++) {
+            const Module &m = cur->modules[j];
+            const double *args = params + m.param;
+            uint64_t key = g.stochastic ? (*kcur)[j] : 0;
+            const Production *p = g.context_sensitive
+                ? g.match(*cur, ctx, j, key, args, ctx_args)
+                : g.match(m.sym, m.nparams, args, key);
+
+            /* Sin producción: el módulo se copia tal cual */
+            if (!p) {
+                Module out = {m.sym, m.nparams, (unsigned int)next->params.size()};
+                next->params.insert(next->params.end(), args, args + m.nparams);
+                next->modules.push_back(out);
+                if (g.stochastic) knext->push_back(key);
+                continue;
+            }
+
+            for (unsigned int k = p->succ_begin; k < p->succ_end; k++) {
+                const SuccModule &sm = g.successors[k];
+                Module out = {sm.sym, sm.nparams, (unsigned int)next->params.size()};
+                for (unsigned int a = 0; a < sm.nparams; a++)
+                    next->params.push_back(g.eval(g.exprs[sm.expr + a], args));
+                next->modules.push_back(out);
+                if (g.stochastic) knext->push_back(child_key(key, k - p->succ_begin));
+            }
+        }
+        std::swap(cur, next);
+        std::swap(kcur, knext);
+    }
+    return *cur;
+}
+
+/* Entrega un módulo terminal a la tortuga */
+static void emit(LSystemInterpreter &tortuga, char sym, unsigned char nparams,
+                 const double *args) {
+    int op = opcode_of(sym);
+    if (op < 0) return;
+
+    Token t;
+    t.op = (unsigned char)op;
+    t.has_arg = nparams > 0;
+    t.arg = nparams ? (float)args[0] : 0.0f;
+    tortuga.exec(t);
+}
+
+/*
+ * Si al módulo le quedan generaciones y tiene producción, se apila un
+ * marco para recorrer su sucesor; si no, es terminal.  Un módulo sin
+ * producción aplicable no cambia en las generaciones siguientes, así que
+ * se puede entregar de inmediato.
+ */
+static void expand(const LSystem &g, LSystemInterpreter &tortuga, char sym,
+                   unsigned char nparams, const double *args, uint64_t key, int level,
+                   std::vector<StreamFrame> &stack) {
+    const Production *p = level > 0 ? g.match(sym, nparams, args, key) : NULL;
+
+    if (!p) {
+        emit(tortuga, sym, nparams, args);
+        return;
+    }
+
+    StreamFrame f;
+    f.p = p;
+    f.next = p->succ_begin;
+    f.level = level - 1;
+    f.key = key;
+    memcpy(f.args, args, nparams * sizeof(double));
+    stack.push_back(f);
+}
+
+size_t stream_derive(const LSystem &g, int n, LSystemInterpreter &tortuga, double *P,
+                     uint64_t seed) {
+    std::vector<StreamFrame> stack;
+    double args[MAX_PARAMS];
+    size_t depth = 0;
+
+    if (g.context_sensitive) {
+        Derivation d;
+        const ModuleString &str = d.run(g, n, seed);
+        tortuga.begin(P);
+        for (const Module &m : str.modules)
+            emit(tortuga, m.sym, m.nparams, str.params.data() + m.param);
+        return 0;
+    }
+
+    stack.reserve(n > 0 ? n : 1);
+    tortuga.begin(P);
+
+    for (size_t i = 0; i < g.axiom.modules.size(); i++) {
+        const Module &m = g.axiom.modules[i];
+        uint64_t key = g.stochastic ? axiom_key(seed, i) : 0;
+        expand(g, tortuga, m.sym, m.nparams, g.axiom.params.data() + m.param, key, n, stack);
+
+        while (!stack.empty()) {
+            StreamFrame &f = stack.back();
+            if (f.next == f.p->succ_end) {
+                stack.pop_back();
+                continue;
+            }
+
+            unsigned int k = f.next++;
+            const SuccModule &sm = g.successors[k];
+            for (unsigned int j = 0; j < sm.nparams; j++)
+                args[j] = g.eval(g.exprs[sm.expr + j], f.args);
+            key = g.stochastic ? child_key(f.key, k - f.p->succ_begin) : 0;
+            expand(g, tortuga, sm.sym, sm.nparams, args, key, f.level, stack);
+
+            if (stack.size() > depth) depth = stack.size();
+        }
+    }
+    return depth;
+}
+
+std::vector<Token> to_tokens(const ModuleString &str) {
+    std::vector<Token> cmds;
+
+    cmds.reserve(str.modules.size());
+    for (const Module &m : str.modules) {
+        int op = opcode_of(m.sym);
+        if (op < 0) continue;
+
+        Token t;
+        t.op = (unsigned char)op;
+        t.has_arg = m.nparams > 0;
+        t.arg = m.nparams ? (float)str.params[m.param] : 0.0f;
+        cmds.push_back(t);
+    }
+    return cmds;
+}
+
+std::string to_string(const ModuleString &str) {
+    std::string out;
+    char num[32];
+
+    for (const Module &m : str.modules) {
+        out += m.sym;
+        if (!m.nparams) continue;
+
+        out += '(';
+        for (unsigned int j = 0; j < m.nparams; j++) {
+            if (j) out += ',';
+            snprintf(num, sizeof(num), "%.12g", str.params[m.param + j]);
+            out += num;
+        }
+        out += ')';
+    }
+    return out;
+}
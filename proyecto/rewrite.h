@@ -0,0 +1,246 @@
+/**
+ * L-systems paramétricos: motor de reescritura.
+ * Basado en el libro de A. Lindenmayer "The Algorithmic Beauty of Plants",
+ * capítulos 1.7 a 1.10 (estocásticos, sensibles al contexto, paramétricos).
+ */
+#ifndef REWRITE_H
+#define REWRITE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "lsystem.h"
+
+#define MAX_PARAMS      8
+#define MAX_EXPR_STACK  32
+
+/* Módulo de una cadena derivada: símbolo y sus parámetros */
+typedef struct {
+    char sym;
+    unsigned char nparams;
+    unsigned int param;     /* índice del primer parámetro en 'params' */
+} Module;
+
+/* Cadena de módulos; los parámetros de todos los módulos son contiguos */
+struct ModuleString {
+    std::vector<Module> modules;
+    std::vector<double> params;
+
+    void clear() { modules.clear(); params.clear(); }
+};
+
+/* Instrucción de una expresión compilada */
+typedef struct {
+    unsigned char op;
+    unsigned char index;    /* parámetro formal para PUSH_PARAM */
+    double value;           /* constante para PUSH_CONST */
+} Instr;
+
+/* Expresión: rango de instrucciones dentro de LSystem::code */
+typedef struct {
+    unsigned int begin;
+    unsigned int end;
+} Expr;
+
+/* Módulo del sucesor: sus parámetros son 'nparams' expresiones seguidas */
+typedef struct {
+    char sym;
+    unsigned char nparams;
+    unsigned int expr;      /* índice de la primera expresión */
+} SuccModule;
+
+/* Módulo de un contexto: símbolo y cantidad de parámetros formales */
+typedef struct {
+    char sym;
+    unsigned char nparams;
+} CtxModule;
+
+/*
+ * Los parámetros formales se numeran en orden de escritura: primero los
+ * del contexto izquierdo ('lparams'), luego los del predecesor y al final
+ * los del contexto derecho.
+ */
+typedef struct {
+    char pred;
+    unsigned char nparams;
+    unsigned char lparams;
+    int cond;               /* índice de la condición, o -1 si es '*' */
+    unsigned int succ_begin;
+    unsigned int succ_end;
+    unsigned int left_begin;    /* contextos: rangos de LSystem::contexts */
+    unsigned int left_end;
+    unsigned int right_begin;
+    unsigned int right_end;
+    double prob;            /* peso si es estocástica, 0 si no */
+} Production;
+
+/*
+ * Vecinos de cada módulo de una cadena para buscar contextos, o -1 si no
+ * hay.  El izquierdo se busca hacia la raíz: se saltan las ramas '[...]'
+ * completas y se sube a través de los '['.  El derecho se busca en la
+ * misma rama, saltando las ramas que salen de ella; un ']' la termina.
+ * Se calculan en una pasada hacia adelante y otra hacia atrás, con una
+ * pila de los '[' abiertos.
+ */
+struct ContextIndex {
+    std::vector<int> left;
+    std::vector<int> right;
+
+    void build(const ModuleString &str, const bool ignore[256]);
+};
+
+/*
+ * Función de mezcla de splitmix64 (Steele, Lea y Flood, 2014).  Aplicada
+ * a un contador que avanza de a SPLITMIX_GAMMA da una secuencia
+ * pseudoaleatoria de buena calidad, y se puede evaluar en cualquier punto.
+ */
+#define SPLITMIX_GAMMA  0x9e3779b97f4a7c15ull
+
+static inline uint64_t splitmix64(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+/*
+ * El azar sale de una llave por módulo y no de un generador secuencial: la
+ * producción elegida no depende del orden de la derivación, así que
+ * Derivation::run, stream_derive y un bosque con cualquier número de hilos
+ * generan el mismo árbol con la misma semilla.
+ *
+ * Llave del k-ésimo módulo derivado de un módulo con llave 'key'
+ */
+static inline uint64_t child_key(uint64_t key, unsigned int k) {
+    return splitmix64(key + (k + 1) * SPLITMIX_GAMMA);
+}
+
+/* Llave del k-ésimo módulo del axioma */
+static inline uint64_t axiom_key(uint64_t seed, unsigned int k) {
+    return child_key(splitmix64(seed), k);
+}
+
+/* Número uniforme en [0, 1) tomado de una llave */
+static inline double key_unit(uint64_t key) {
+    return (key >> 11) * 0x1p-53;
+}
+
+class LSystem {
+public:
+    LSystem();
+
+    /*
+     * Lee una gramática completa con la notación del libro:
+     *
+     *   #define r1 0.9
+     *   #ignore: +-
+     *   n: 10
+     *   w: A(1,10)
+     *   p1: A(l,w) : * -> !(w)F(l)[&(a0)B(l*r2,w*wr)]/(d)A(l*r1,w*wr)
+     *   p2: F -> F[+F]F : 0.33
+     *   p3: A(x) < B(y) > C(z) : x < z -> B(y+1)
+     *
+     * Un peso al final del sucesor hace estocástica a la producción: entre
+     * las que se pueden aplicar se elige con probabilidad proporcional al
+     * peso.  'izq < pred > der' da los contextos (ver ContextIndex), que
+     * no ven los símbolos de #ignore; las sensibles al contexto se prueban
+     * antes que las demás.  Las expresiones se compilan a notación polaca
+     * inversa (ver Instr).
+     */
+    bool parse(const std::string &text);
+    bool define(const std::string &name, double value);
+    bool set_axiom(const std::string &axiom);
+    bool add_production(const std::string &rule);
+
+    /*
+     * Busca la producción que se aplica a un módulo, o NULL si ninguna.
+     * 'key' elige entre las estocásticas.  Esta versión no ve a los
+     * vecinos del módulo, así que no aplica las sensibles al contexto.
+     */
+    const Production *match(char sym, unsigned char nparams, const double *args,
+                            uint64_t key = 0) const;
+    /*
+     * Lo mismo para el módulo i de 'str', con contextos.  'args' queda
+     * apuntando a los parámetros con que se evalúa el sucesor: los del
+     * módulo, o 'buf' (MAX_PARAMS) con los formales de los contextos.
+     */
+    const Production *match(const ModuleString &str, const ContextIndex &ctx, size_t i,
+                            uint64_t key, const double *&args, double *buf) const;
+    double eval(const Expr &e, const double *args) const;
+
+    int iterations;
+    std::string error;
+
+    /* Hay producciones estocásticas / sensibles al contexto */
+    bool stochastic;
+    bool context_sensitive;
+    /* Símbolos que no cuentan al buscar contextos (#ignore) */
+    bool ignore[256];
+
+    ModuleString axiom;
+    std::vector<Production> productions;
+    std::vector<SuccModule> successors;
+    std::vector<CtxModule> contexts;
+    std::vector<Expr> exprs;
+    std::vector<Instr> code;
+
+private:
+    bool fail(const std::string &msg);
+    bool compile(const char *&s, const char *end,
+                 const std::vector<std::string> &formals, Expr *e);
+    bool parse_modules(const std::string &text, std::vector<CtxModule> &out,
+                       std::vector<std::string> &formals);
+    bool applies(const Production &p, unsigned char nparams, const double *args,
+                 const ModuleString *str, const ContextIndex *ctx, size_t i,
+                 const double *&out, double *buf) const;
+    const Production *select(char sym, unsigned char nparams, const double *args,
+                             uint64_t key, const ModuleString *str, const ContextIndex *ctx,
+                             size_t i, const double *&out, double *buf) const;
+
+    std::vector<std::string> const_names;
+    std::vector<double> const_values;
+    /* Producciones de cada símbolo: las sensibles al contexto primero y,
+       dentro de cada grupo, en orden de declaración */
+    std::vector<unsigned int> by_symbol[256];
+};
+
+/*
+ * Buffers de derivación.  Se pueden reutilizar entre llamadas a run(); la
+ * memoria reservada crece solo cuando una cadena supera a las anteriores.
+ * Las llaves de los módulos solo se guardan si la gramática es
+ * estocástica, y los vecinos solo si es sensible al contexto.
+ */
+class Derivation {
+public:
+    const ModuleString &run(const LSystem &g, int n, uint64_t seed = 0);
+
+private:
+    ModuleString buf[2];
+    std::vector<uint64_t> keys[2];
+    ContextIndex ctx;
+};
+
+/* Marco de la pila de expansión en profundidad (stream_derive) */
+typedef struct {
+    const Production *p;
+    unsigned int next;          /* próximo módulo del sucesor */
+    int level;                  /* generaciones restantes de sus módulos */
+    uint64_t key;               /* llave del predecesor */
+    double args[MAX_PARAMS];    /* parámetros del predecesor */
+} StreamFrame;
+
+/*
+ * Deriva 'n' generaciones en profundidad y entrega cada símbolo terminal
+ * directamente a la tortuga, sin construir la cadena derivada.  La pila
+ * tiene a lo más 'n' marcos.  Devuelve la profundidad máxima alcanzada.
+ * Una gramática sensible al contexto necesita la cadena completa de cada
+ * generación: se deriva con Derivation y se devuelve 0.
+ */
+size_t stream_derive(const LSystem &g, int n, LSystemInterpreter &tortuga, double *P,
+                     uint64_t seed = 0);
+
+/* Traduce una cadena de módulos a comandos de la tortuga */
+std::vector<Token> to_tokens(const ModuleString &str);
+/* Cadena en el formato de data/N.txt (parámetros con 12 dígitos) */
+std::string to_string(const ModuleString &str);
+
+#endif
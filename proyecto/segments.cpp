@@ -0,0 +1,204 @@
+/**
+ * L-systems: almacén compacto de segmentos.
+ */
+#include <cmath>
+#include "lsystem.h"
+#include "segments.h"
+#include "trace.h"
+
+#define SNORM16         32767.0
+
+void SegmentStore::clear() {
+    pos.clear();
+    q.clear();
+    width.clear();
+    length.clear();
+    parent.clear();
+    version++;
+}
+
+/* Segmentos agregados y cambios de capacidad desde old_size y old_capacity */
+static inline void trace_growth(const SegmentStore &s, size_t old_size, size_t old_capacity) {
+    if (s.size() > old_size)
+        TRACE_COUNT(TRACE_SEGMENTS, s.size() - old_size);
+    if (s.width.capacity() != old_capacity) {
+        TRACE_COUNT(TRACE_REALLOCS, 1);
+        TRACE_COUNT(TRACE_REALLOC_BYTES, s.bytes());
+    }
+}
+
+void SegmentStore::reserve(size_t n) {
+    size_t capacity = width.capacity();
+
+    pos.reserve(3 * n);
+    q.reserve(4 * n);
+    width.reserve(n);
+    length.reserve(n);
+    parent.reserve(n);
+    trace_growth(*this, size(), capacity);
+}
+
+void SegmentStore::resize(size_t n) {
+    size_t old = size(), capacity = width.capacity();
+
+    pos.resize(3 * n);
+    q.resize(4 * n);
+    width.resize(n);
+    length.resize(n);
+    parent.resize(n);
+    version++;
+    trace_growth(*this, old, capacity);
+}
+
+void SegmentStore::shrink_to_fit() {
+    pos.shrink_to_fit();
+    q.shrink_to_fit();
+    width.shrink_to_fit();
+    length.shrink_to_fit();
+    parent.shrink_to_fit();
+}
+
+size_t SegmentStore::bytes() const {
+    return pos.capacity() * sizeof(float) + q.capacity() * sizeof(short) +
+           width.capacity() * sizeof(float) + length.capacity() * sizeof(float) +
+           parent.capacity() * sizeof(unsigned int);
+}
+
+void SegmentStore::push_back(const double P0[DIM], const double T[DIM][DIM], double w, double len,
+                             unsigned int parent) {
+    resize(size() + 1);
+    set(size() - 1, P0, T, w, len, parent);
+}
+
+/*
+ * Cuaternión de la rotación R = T*F (método de Shepperd: se parte por la
+ * componente más grande para no perder precisión).
+ */
+void turtle_quat(const double T[DIM][DIM], double v[4]) {
+    double R[DIM][DIM];
+
+    for (int k = 0; k < DIM; k++) {
+        R[k][0] = T[k][0];
+        R[k][1] = T[k][1];
+        R[k][2] = -T[k][2];
+    }
+
+    double tr = R[0][0] + R[1][1] + R[2][2];
+    if (tr > 0) {
+        double s = sqrt(tr + 1.0) * 2;
+        v[3] = 0.25 * s;
+        v[0] = (R[2][1] - R[1][2]) / s;
+        v[1] = (R[0][2] - R[2][0]) / s;
+        v[2] = (R[1][0] - R[0][1]) / s;
+    }
+    else if (R[0][0] > R[1][1] && R[0][0] > R[2][2]) {
+        double s = sqrt(1.0 + R[0][0] - R[1][1] - R[2][2]) * 2;
+        v[3] = (R[2][1] - R[1][2]) / s;
+        v[0] = 0.25 * s;
+        v[1] = (R[0][1] + R[1][0]) / s;
+        v[2] = (R[0][2] + R[2][0]) / s;
+    }
+    else if (R[1][1] > R[2][2]) {
+        double s = sqrt(1.0 + R[1][1] - R[0][0] - R[2][2]) * 2;
+        v[3] = (R[0][2] - R[2][0]) / s;
+        v[0] = (R[0][1] + R[1][0]) / s;
+        v[1] = 0.25 * s;
+        v[2] = (R[1][2] + R[2][1]) / s;
+    }
+    else {
+        double s = sqrt(1.0 + R[2][2] - R[0][0] - R[1][1]) * 2;
+        v[3] = (R[1][0] - R[0][1]) / s;
+        v[0] = (R[0][2] + R[2][0]) / s;
+        v[1] = (R[1][2] + R[2][1]) / s;
+        v[2] = 0.25 * s;
+    }
+}
+
+void SegmentStore::set(size_t i, const double P0[DIM], const double T[DIM][DIM], double w, double len,
+                       unsigned int parent) {
+    double v[4];
+
+    turtle_quat(T, v);
+    set_quat(i, P0, v, w, len, parent);
+}
+
+/* Se deja w >= 0 para que cada orientación tenga una sola representación */
+void SegmentStore::set_quat(size_t i, const double P0[DIM], const double v[4], double w, double len,
+                            unsigned int parent) {
+    double sign = v[3] < 0 ? -1.0 : 1.0;
+    for (int k = 0; k < 4; k++)
+        q[4*i + k] = (short)lrint(sign * v[k] * SNORM16);
+
+    pos[3*i]     = (float)P0[0];
+    pos[3*i + 1] = (float)P0[1];
+    pos[3*i + 2] = (float)P0[2];
+    width[i] = (float)w;
+    length[i] = (float)len;
+    this->parent[i] = parent;
+}
+
+/* Cuaternión guardado, renormalizado para corregir el error de cuantización */
+void SegmentStore::quat(size_t i, double v[4]) const {
+    double n = 0;
+
+    for (int k = 0; k < 4; k++) {
+        v[k] = q[4*i + k] / SNORM16;
+        n += v[k] * v[k];
+    }
+    n = 1.0 / sqrt(n);
+    for (int k = 0; k < 4; k++)
+        v[k] *= n;
+}
+
+void SegmentStore::orientation(size_t i, double T[DIM][DIM]) const {
+    double x = q[4*i] / SNORM16, y = q[4*i + 1] / SNORM16;
+    double z = q[4*i + 2] / SNORM16, w = q[4*i + 3] / SNORM16;
+    /* Renormalizar para corregir el error de cuantización */
+    double n = 1.0 / sqrt(x*x + y*y + z*z + w*w);
+    x *= n; y *= n; z *= n; w *= n;
+
+    T[0][0] = 1 - 2*(y*y + z*z);
+    T[0][1] = 2*(x*y - z*w);
+    T[0][2] = -2*(x*z + y*w);
+    T[1][0] = 2*(x*y + z*w);
+    T[1][1] = 1 - 2*(x*x + z*z);
+    T[1][2] = -2*(y*z - x*w);
+    T[2][0] = 2*(x*z - y*w);
+    T[2][1] = 2*(y*z + x*w);
+    T[2][2] = -(1 - 2*(x*x + y*y));
+}
+
+void SegmentStore::start_point(size_t i, double P0[DIM]) const {
+    P0[0] = pos[3*i];
+    P0[1] = pos[3*i + 1];
+    P0[2] = pos[3*i + 2];
+}
+
+void SegmentStore::end_point(size_t i, double P1[DIM]) const {
+    double T[DIM][DIM];
+
+    orientation(i, T);
+    for (int k = 0; k < DIM; k++)
+        P1[k] = pos[3*i + k] + length[i] * T[k][0];
+}
+
+void SegmentStore::gl_matrix(size_t i, double M[16]) const {
+    double T[DIM][DIM];
+
+    /*
+     * Rotación que alinea el eje Z del cilindro con el Heading: T*Ry(90),
+     * con Ry(90) = {{0,0,1},{0,1,0},{-1,0,0}}.  Sólo permuta columnas de T
+     * (-Z, Y, X), así que no hace falta estado compartido entre hilos.
+     */
+    orientation(i, T);
+    for (int k = 0; k < DIM; k++) {
+        M[k]     = -T[k][2];
+        M[4 + k] = T[k][1];
+        M[8 + k] = T[k][0];
+    }
+    M[3] = M[7] = M[11] = 0.0;
+    M[12] = pos[3*i];
+    M[13] = pos[3*i + 1];
+    M[14] = pos[3*i + 2];
+    M[15] = 1.0;
+}
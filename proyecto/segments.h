@@ -0,0 +1,81 @@
+/**
+ * L-systems: almacén compacto de segmentos.
+ */
+#ifndef SEGMENTS_H
+#define SEGMENTS_H
+
+#include <cstddef>
+#include <vector>
+
+#ifndef DIM
+#define DIM             3
+#endif
+
+#define NO_PARENT       0xffffffffu
+
+/* Cada segmento es un cilindro truncado: radio de un segmento de grosor 1 */
+#define CYL_RADIUS      0.02
+/* Relación entre el radio superior e inferior de cada segmento */
+#define CYL_TAPER       0.8
+
+/*
+ * Segmentos generados por la tortuga en forma de estructura de arreglos.
+ * Solo se guarda lo que no se puede derivar:
+ *   pos:    punto inicial P0 (3 float por segmento)
+ *   q:      orientación [H L U] como cuaternión en snorm16 (4 short)
+ *   width:  grosor ('!')
+ *   length: largo ('F')
+ *   parent: segmento desde cuyo extremo crece este (el tronco del que
+ *           sale una rama), o NO_PARENT
+ * P1 = P0 + length * H y la matriz 4x4 de OpenGL se reconstruyen cuando se
+ * necesitan.  Son 32 bytes por segmento, contra 200 de LineSegment.
+ *
+ * La matriz de la tortuga parte como [[0 1 0] [1 0 0] [0 0 1]], que tiene
+ * determinante -1 (H x L = -U), y las rotaciones lo conservan.  Por eso se
+ * guarda el cuaternión de T*F con F = diag(1, 1, -1) y al decodificar se
+ * invierte la columna U.
+ */
+class SegmentStore {
+public:
+    SegmentStore() : version(0) {}
+
+    void clear();
+    void reserve(size_t n);
+    void resize(size_t n);
+    void shrink_to_fit();
+    size_t size() const { return width.size(); }
+    /* Memoria reservada por los arreglos, en bytes */
+    size_t bytes() const;
+
+    void push_back(const double P0[DIM], const double T[DIM][DIM], double w, double len,
+                   unsigned int parent = NO_PARENT);
+    void set(size_t i, const double P0[DIM], const double T[DIM][DIM], double w, double len,
+             unsigned int parent = NO_PARENT);
+    /* Igual que set(), con la orientación ya como cuaternión (x, y, z, w) */
+    void set_quat(size_t i, const double P0[DIM], const double v[4], double w, double len,
+                  unsigned int parent = NO_PARENT);
+
+    /* Reconstrucción de los datos derivados */
+    void quat(size_t i, double v[4]) const;
+    void orientation(size_t i, double T[DIM][DIM]) const;
+    void start_point(size_t i, double P0[DIM]) const;
+    void end_point(size_t i, double P1[DIM]) const;
+    /* Matriz (column-major) para glMultMatrixd, igual a la de assign_GL_mat */
+    void gl_matrix(size_t i, double M[16]) const;
+
+    std::vector<float> pos;
+    std::vector<short> q;
+    std::vector<float> width;
+    std::vector<float> length;
+    std::vector<unsigned int> parent;
+    /*
+     * Cambia con cada clear() o resize(), es decir, cada vez que se genera
+     * un árbol.  Permite saber si una copia (p. ej. en la GPU) está vigente.
+     */
+    unsigned long version;
+};
+
+/* Cuaternión de la rotación T*F (la orientación de la tortuga T) */
+void turtle_quat(const double T[DIM][DIM], double v[4]);
+
+#endif
@@ -0,0 +1,575 @@
+/**
+ * L-systems: instanciado de subárboles repetidos.
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include "rewrite.h"
+#include "subtree.h"
+
+#define NO_GROUP        0xffffffffu
+/* Bits de mantisa (de 23) que se descartan al comparar largos y grosores */
+#define QUANT_DROP      9
+/* Palabra que abre una forma interna: número, largo y grosor relativos */
+#define CHILD_WORD      0x100u
+/* Memoria de un segmento en SegmentStore */
+#define SEGMENT_BYTES   (5 * sizeof(float) + 4 * sizeof(short) + sizeof(unsigned int))
+
+/* Grupo entre corchetes; end es NO_GROUP si el '[' no se cierra */
+typedef struct {
+    uint32_t begin;
+    uint32_t end;
+    uint32_t shape;
+    double s;               /* largo del primer 'F' (1 si no hay) */
+    double sw;              /* grosor de entrada (1 si es 0) */
+    bool zero;              /* entró con grosor 0 */
+} GroupInfo;
+
+/* Grupo abierto durante el recorrido */
+typedef struct {
+    uint32_t group;
+    double s;               /* 0 mientras no aparezca un 'F' */
+} OpenGroup;
+
+static uint32_t float_bits(float f) {
+    uint32_t b;
+    memcpy(&b, &f, sizeof(b));
+    return b;
+}
+
+static float bits_float(uint32_t b) {
+    float f;
+    memcpy(&f, &b, sizeof(f));
+    return f;
+}
+
+/* Redondea a 14 bits de mantisa para que escalas casi iguales coincidan */
+static uint32_t quantize(double x) {
+    uint32_t b = float_bits((float)x);
+    return (b + (1u << (QUANT_DROP - 1))) & ~((1u << QUANT_DROP) - 1);
+}
+
+/* r = a*b */
+static void qmul(const double a[4], const double b[4], double r[4]) {
+    double x = a[3]*b[0] + b[3]*a[0] + a[1]*b[2] - a[2]*b[1];
+    double y = a[3]*b[1] + b[3]*a[1] + a[2]*b[0] - a[0]*b[2];
+    double z = a[3]*b[2] + b[3]*a[2] + a[0]*b[1] - a[1]*b[0];
+    double w = a[3]*b[3] - a[0]*b[0] - a[1]*b[1] - a[2]*b[2];
+    r[0] = x; r[1] = y; r[2] = z; r[3] = w;
+}
+
+/* r = q*v*q^-1, como qrot en el shader */
+static void qrot(const double q[4], const double v[DIM], double r[DIM]) {
+    double t[DIM] = {q[1]*v[2] - q[2]*v[1] + q[3]*v[0],
+                     q[2]*v[0] - q[0]*v[2] + q[3]*v[1],
+                     q[0]*v[1] - q[1]*v[0] + q[3]*v[2]};
+    r[0] = v[0] + 2.0 * (q[1]*t[2] - q[2]*t[1]);
+    r[1] = v[1] + 2.0 * (q[2]*t[0] - q[0]*t[2]);
+    r[2] = v[2] + 2.0 * (q[0]*t[1] - q[1]*t[0]);
+}
+
+void SubtreeLayout::clear() {
+    segments.clear();
+    shapes.clear();
+    instances.clear();
+    threshold = 0;
+}
+
+void SubtreeLayout::release() {
+    clear();
+    segments.shrink_to_fit();
+    std::vector<LayoutShape>().swap(shapes);
+    std::vector<SubtreeInstance>().swap(instances);
+}
+
+size_t SubtreeLayout::bytes() const {
+    return segments.bytes() + shapes.capacity() * sizeof(LayoutShape) +
+           instances.capacity() * sizeof(SubtreeInstance);
+}
+
+SubtreeScene::SubtreeScene() : groups(0), origin{0, 0, 0}, rotation{0, 0, 0, 1} {
+}
+
+void SubtreeScene::clear() {
+    shapes.clear();
+    children.clear();
+    segments.clear();
+    groups = 0;
+}
+
+size_t SubtreeScene::flat_bytes() const {
+    return size() * SEGMENT_BYTES;
+}
+
+size_t SubtreeScene::bytes() const {
+    return segments.bytes() + shapes.capacity() * sizeof(SubtreeShape) +
+           children.capacity() * sizeof(SubtreeChild);
+}
+
+void SubtreeScene::build(const std::vector<Token> &cmds, const LSystemInterpreter &tortuga,
+                         const double *P) {
+    build(cmds.data(), cmds.size(), tortuga, P);
+}
+
+void SubtreeScene::build(const Token *cmds, size_t n, const LSystemInterpreter &tortuga,
+                         const double *P) {
+    std::vector<GroupInfo> info;
+    std::vector<uint32_t> open;
+
+    clear();
+
+    /* Corchetes: un GroupInfo por '[' en orden, con su ']' si lo tiene */
+    for (size_t i = 0; i < n; i++) {
+        if (cmds[i].op == OP_PUSH) {
+            GroupInfo g = {(uint32_t)i, NO_GROUP, 0, 1.0, 1.0, false};
+            open.push_back((uint32_t)info.size());
+            info.push_back(g);
+        }
+        else if (cmds[i].op == OP_POP && !open.empty()) {
+            info[open.back()].end = (uint32_t)i;
+            open.pop_back();
+        }
+    }
+
+    /*
+     * Contenido normalizado de cada grupo.  Un '[' sin cerrar o un ']' sin
+     * abrir nunca quedan dentro de un grupo, así que dentro de uno todos
+     * los corchetes son grupos internos.  El grosor se sigue como lo haría
+     * la tortuga para saber con cuál entra cada grupo.
+     */
+    std::vector<OpenGroup> stack;
+    std::vector<std::vector<uint32_t>> words;
+    std::vector<double> wstack;
+    std::vector<uint32_t> canon, canon_first, rep;
+    std::unordered_map<uint64_t, uint32_t> table;
+    double width = DEFAULT_WIDTH;
+    size_t next = 0;
+
+    auto emit = [&](uint32_t a, uint32_t b) {
+        if (stack.empty()) return;
+        std::vector<uint32_t> &w = words[stack.size() - 1];
+        w.push_back(a);
+        w.push_back(b);
+    };
+
+    for (size_t i = 0; i < n; i++) {
+        const Token &t = cmds[i];
+
+        switch (t.op) {
+        case OP_PUSH: {
+            GroupInfo &g = info[next++];
+            wstack.push_back(width);
+            if (g.end == NO_GROUP)
+                break;
+            g.zero = width == 0;
+            g.sw = g.zero ? 1.0 : width;
+            OpenGroup o = {(uint32_t)(next - 1), 0.0};
+            stack.push_back(o);
+            if (words.size() < stack.size())
+                words.resize(stack.size());
+            words[stack.size() - 1].clear();
+            break;
+        }
+        case OP_POP: {
+            if (!wstack.empty()) {
+                width = wstack.back();
+                wstack.pop_back();
+            }
+            if (stack.empty())
+                break;
+
+            OpenGroup o = stack.back();
+            GroupInfo &g = info[o.group];
+            std::vector<uint32_t> &w = words[stack.size() - 1];
+            g.s = o.s != 0 ? o.s : 1.0;
+
+            /* Largos relativos al primer 'F' del grupo */
+            uint64_t h = splitmix64(g.zero);
+            for (size_t k = 0; k < w.size(); ) {
+                if (w[k] == CHILD_WORD) {
+                    w[k + 2] = quantize(bits_float(w[k + 2]) / g.s);
+                    k += 4;
+                    continue;
+                }
+                if (w[k] == OP_FORWARD)
+                    w[k + 1] = quantize(bits_float(w[k + 1]) / g.s);
+                k += 2;
+            }
+            for (uint32_t x : w)
+                h = splitmix64(h ^ x);
+
+            /* Forma existente con las mismas palabras, o una nueva */
+            uint32_t id = NO_GROUP;
+            auto it = table.find(h);
+            if (it != table.end()) {
+                uint32_t c = it->second;
+                size_t len = canon_first[c + 1] - canon_first[c];
+                if (len == w.size() + 1 && canon[canon_first[c]] == (uint32_t)g.zero &&
+                    std::equal(w.begin(), w.end(), canon.begin() + canon_first[c] + 1))
+                    id = c;
+            }
+            if (id == NO_GROUP) {
+                id = (uint32_t)rep.size();
+                rep.push_back(o.group);
+                if (canon_first.empty())
+                    canon_first.push_back(0);
+                canon.push_back(g.zero);
+                canon.insert(canon.end(), w.begin(), w.end());
+                canon_first.push_back((uint32_t)canon.size());
+                table.emplace(h, id);
+            }
+            g.shape = id;
+            groups++;
+
+            stack.pop_back();
+            if (!stack.empty()) {
+                emit(CHILD_WORD, id);
+                emit(float_bits((float)g.s), quantize(g.sw / info[stack.back().group].sw));
+            }
+            break;
+        }
+        case OP_FORWARD: {
+            double len = t.has_arg ? t.arg : tortuga.lstep;
+            for (size_t k = stack.size(); k > 0 && stack[k - 1].s == 0; k--)
+                stack[k - 1].s = len;
+            emit(t.op, float_bits((float)len));
+            break;
+        }
+        case OP_WIDTH:
+            width = t.has_arg ? t.arg : tortuga.lwidth;
+            if (!stack.empty())
+                emit(t.op, quantize(width / info[stack.back().group].sw));
+            break;
+        default:
+            emit(t.op, float_bits(t.has_arg ? t.arg : (float)tortuga.langle));
+            break;
+        }
+    }
+
+    /*
+     * Geometría de cada forma a partir de su primer grupo, y al final la
+     * raíz.  Las formas internas tienen números menores, así que ya están
+     * construidas.
+     */
+    std::vector<State> pila;
+    SegmentStore none;
+    State init;
+    double zero[DIM] = {0, 0, 0};
+
+    initial_state(init, (double *)P);
+    assign_vec(origin, init.P);
+    turtle_quat(init.T, rotation);
+
+    auto interpret = [&](size_t from, size_t to, double s, double sw, double w0) {
+        SubtreeShape sh;
+        State L;
+        size_t count = 0;
+
+        initial_state(L, zero);
+        for (int r = 0; r < DIM; r++)
+            for (int c = 0; c < DIM; c++)
+                L.T[r][c] = r == c ? (r == 2 ? -1.0 : 1.0) : 0.0;
+        L.width = w0;
+        pila.clear();
+
+        sh.first = (uint32_t)segments.size();
+        sh.child_first = (uint32_t)children.size();
+        for (size_t i = from; i < to; i++) {
+            const Token &t = cmds[i];
+
+            if (t.op == OP_PUSH) {
+                auto g = std::lower_bound(info.begin(), info.end(), (uint32_t)i,
+                    [](const GroupInfo &a, uint32_t b) { return a.begin < b; });
+                if (g->end != NO_GROUP) {
+                    SubtreeChild c;
+                    double v[4];
+                    c.shape = g->shape;
+                    c.at = (uint32_t)(segments.size() - sh.first);
+                    c.parent = L.parent;
+                    for (int d = 0; d < DIM; d++)
+                        c.P[d] = (float)L.P[d];
+                    turtle_quat(L.T, v);
+                    for (int k = 0; k < 4; k++)
+                        c.q[k] = (float)v[k];
+                    c.scale = (float)(g->s / s);
+                    c.wscale = (float)(g->sw / sw);
+                    children.push_back(c);
+                    count += shapes[g->shape].total;
+                    i = g->end;
+                    continue;
+                }
+            }
+            if (t.op == OP_FORWARD) {
+                double len = (t.has_arg ? t.arg : tortuga.lstep) / s;
+                segments.push_back(L.P, L.T, L.width, len, L.parent);
+                L.parent = (unsigned int)count++;
+                for (int d = 0; d < DIM; d++)
+                    L.P[d] += L.T[d][0] * len;
+            }
+            else if (t.op == OP_WIDTH)
+                L.width = (t.has_arg ? t.arg : tortuga.lwidth) / sw;
+            else
+                tortuga.turtle_step(L, pila, t, none, 0);
+        }
+        sh.count = (uint32_t)(segments.size() - sh.first);
+        sh.children = (uint32_t)(children.size() - sh.child_first);
+        sh.total = count;
+        sh.uses = 0;
+        shapes.push_back(sh);
+    };
+
+    for (uint32_t g : rep) {
+        const GroupInfo &r = info[g];
+        interpret(r.begin + 1, r.end, r.s, r.sw, r.zero ? 0.0 : 1.0);
+    }
+    interpret(0, n, 1.0, 1.0, init.width);
+    shapes.back().uses = 1;
+    for (const GroupInfo &g : info)
+        if (g.end != NO_GROUP)
+            shapes[g.shape].uses++;
+    segments.shrink_to_fit();
+    children.shrink_to_fit();
+    shapes.shrink_to_fit();
+}
+
+/*
+ * Escribe los segmentos de la forma s, con transformación (P, q, scale,
+ * wscale) y padre de entrada 'parent', desde out[base]; devuelve la
+ * posición siguiente.  Las formas internas marcadas en 'cut' no se
+ * expanden: se agregan a 'cuts' con su transformación.
+ */
+size_t SubtreeScene::expand(uint32_t s, const double P[DIM], const double q[4], double scale,
+                            double wscale, unsigned int parent, SegmentStore &out, size_t base,
+                            const std::vector<char> *cut, std::vector<SubtreeInstance> *cuts) const {
+    const SubtreeShape &sh = shapes[s];
+    uint32_t c = sh.child_first, cend = sh.child_first + sh.children;
+    size_t k = base;
+
+    for (uint32_t i = 0; ; i++) {
+        for (; c < cend && children[c].at == i; c++) {
+            const SubtreeChild &ch = children[c];
+            double lp[DIM] = {ch.P[0], ch.P[1], ch.P[2]};
+            double lq[4] = {ch.q[0], ch.q[1], ch.q[2], ch.q[3]};
+            double cP[DIM], cq[4];
+
+            qrot(q, lp, cP);
+            for (int d = 0; d < DIM; d++)
+                cP[d] = P[d] + scale * cP[d];
+            qmul(q, lq, cq);
+            if (cut && (*cut)[ch.shape]) {
+                SubtreeInstance inst;
+                inst.shape = ch.shape;
+                for (int d = 0; d < DIM; d++)
+                    inst.P[d] = (float)cP[d];
+                for (int d = 0; d < 4; d++)
+                    inst.q[d] = (float)cq[d];
+                inst.scale = (float)(scale * ch.scale);
+                inst.wscale = (float)(wscale * ch.wscale);
+                cuts->push_back(inst);
+                continue;
+            }
+            unsigned int cp = ch.parent == NO_PARENT ? parent : (unsigned int)(base + ch.parent);
+            k = expand(ch.shape, cP, cq, scale * ch.scale, wscale * ch.wscale, cp, out, k, cut, cuts);
+        }
+        if (i == sh.count)
+            break;
+
+        size_t j = sh.first + i;
+        double lp[DIM], lq[4], wp[DIM], wq[4];
+        segments.start_point(j, lp);
+        segments.quat(j, lq);
+        qrot(q, lp, wp);
+        for (int d = 0; d < DIM; d++)
+            wp[d] = P[d] + scale * wp[d];
+        qmul(q, lq, wq);
+        unsigned int sp = segments.parent[j];
+        out.set_quat(k++, wp, wq, wscale * segments.width[j], scale * segments.length[j],
+                     sp == NO_PARENT ? parent : (unsigned int)(base + sp));
+    }
+    return k;
+}
+
+void SubtreeScene::flatten(SegmentStore &out) const {
+    out.clear();
+    if (shapes.empty())
+        return;
+    out.resize(size());
+    expand((uint32_t)shapes.size() - 1, origin, rotation, 1.0, 1.0, NO_PARENT, out, 0, NULL, NULL);
+}
+
+/*
+ * Para el corte en 'threshold': segmentos que se suben por cada forma
+ * (los propios y los de las formas internas que no se cortan) e
+ * instancias que genera cada una (ella misma y las de sus cortes).
+ */
+void SubtreeScene::cut_sizes(size_t threshold, std::vector<size_t> &content,
+                             std::vector<size_t> &instances) const {
+    size_t root = shapes.size() - 1;
+
+    content.assign(shapes.size(), 0);
+    instances.assign(shapes.size(), 1);
+    for (size_t s = 0; s < shapes.size(); s++) {
+        const SubtreeShape &sh = shapes[s];
+        content[s] = sh.count;
+        for (uint32_t c = sh.child_first; c < sh.child_first + sh.children; c++) {
+            uint32_t x = children[c].shape;
+            if (threshold && x != root && shapes[x].total >= threshold)
+                instances[s] += instances[x];
+            else
+                content[s] += content[x];
+        }
+    }
+}
+
+/* Ordena un tramo de segmentos de mayor a menor grosor */
+static void sort_by_width(SegmentStore &lines, size_t first, size_t count) {
+    std::vector<uint32_t> order(count);
+    SegmentStore tmp;
+
+    for (size_t k = 0; k < count; k++)
+        order[k] = (uint32_t)(first + k);
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return lines.width[a] > lines.width[b];
+    });
+    tmp.resize(count);
+    for (size_t k = 0; k < count; k++) {
+        size_t i = order[k];
+        std::copy(&lines.pos[3*i], &lines.pos[3*i] + 3, &tmp.pos[3*k]);
+        std::copy(&lines.q[4*i], &lines.q[4*i] + 4, &tmp.q[4*k]);
+        tmp.width[k] = lines.width[i];
+        tmp.length[k] = lines.length[i];
+    }
+    std::copy(tmp.pos.begin(), tmp.pos.end(), lines.pos.begin() + 3 * first);
+    std::copy(tmp.q.begin(), tmp.q.end(), lines.q.begin() + 4 * first);
+    std::copy(tmp.width.begin(), tmp.width.end(), lines.width.begin() + first);
+    std::copy(tmp.length.begin(), tmp.length.end(), lines.length.begin() + first);
+    std::fill(lines.parent.begin() + first, lines.parent.begin() + first + count, NO_PARENT);
+}
+
+void SubtreeScene::layout(size_t threshold, SubtreeLayout &out) const {
+    std::vector<size_t> content, instances;
+    std::vector<std::vector<SubtreeInstance>> cuts(shapes.size());
+    std::vector<uint32_t> index(shapes.size(), NO_GROUP);
+    std::vector<char> cut(shapes.size(), 0);
+    double zero[DIM] = {0, 0, 0}, identity[4] = {0, 0, 0, 1};
+
+    out.clear();
+    out.threshold = threshold;
+    if (shapes.empty())
+        return;
+
+    size_t root = shapes.size() - 1;
+    for (size_t s = 0; threshold && s < root; s++)
+        cut[s] = shapes[s].total >= threshold;
+    cut_sizes(threshold, content, instances);
+
+    /* Segmentos locales de cada forma del corte */
+    for (size_t s = 0; s <= root; s++) {
+        if (!cut[s] && s != root)
+            continue;
+        LayoutShape ls;
+        ls.first = (uint32_t)out.segments.size();
+        ls.count = (uint32_t)content[s];
+        out.segments.resize(ls.first + ls.count);
+        expand((uint32_t)s, zero, identity, 1.0, 1.0, NO_PARENT, out.segments, ls.first, &cut, &cuts[s]);
+        sort_by_width(out.segments, ls.first, ls.count);
+
+        /* Esfera en el centro de la caja de los extremos */
+        double lo[DIM], hi[DIM];
+        for (int d = 0; d < DIM; d++) {
+            lo[d] = HUGE_VAL;
+            hi[d] = -HUGE_VAL;
+        }
+        for (size_t i = ls.first; i < ls.first + ls.count; i++) {
+            double P0[DIM], P1[DIM];
+            out.segments.start_point(i, P0);
+            out.segments.end_point(i, P1);
+            for (int d = 0; d < DIM; d++) {
+                lo[d] = std::min(lo[d], std::min(P0[d], P1[d]));
+                hi[d] = std::max(hi[d], std::max(P0[d], P1[d]));
+            }
+        }
+        double r2 = 0;
+        ls.radius = ls.wradius = 0;
+        for (int d = 0; d < DIM; d++)
+            ls.center[d] = ls.count ? (float)((lo[d] + hi[d]) / 2) : 0.0f;
+        for (size_t i = ls.first; i < ls.first + ls.count; i++) {
+            double E[2][DIM];
+            out.segments.start_point(i, E[0]);
+            out.segments.end_point(i, E[1]);
+            for (int e = 0; e < 2; e++) {
+                double d2 = 0;
+                for (int d = 0; d < DIM; d++)
+                    d2 += (E[e][d] - ls.center[d]) * (E[e][d] - ls.center[d]);
+                r2 = std::max(r2, d2);
+            }
+            ls.wradius = std::max(ls.wradius, (float)(CYL_RADIUS * out.segments.width[i]));
+        }
+        ls.radius = (float)sqrt(r2);
+        index[s] = (uint32_t)out.shapes.size();
+        out.shapes.push_back(ls);
+    }
+
+    /* Instancias en el mundo, componiendo las transformaciones de los cortes */
+    std::vector<SubtreeInstance> pending;
+    SubtreeInstance r;
+    r.shape = (uint32_t)root;
+    for (int d = 0; d < DIM; d++)
+        r.P[d] = (float)origin[d];
+    for (int d = 0; d < 4; d++)
+        r.q[d] = (float)rotation[d];
+    r.scale = r.wscale = 1.0f;
+    pending.push_back(r);
+    out.instances.reserve(instances[root]);
+    while (!pending.empty()) {
+        SubtreeInstance w = pending.back();
+        double P[DIM] = {w.P[0], w.P[1], w.P[2]}, q[4] = {w.q[0], w.q[1], w.q[2], w.q[3]};
+        pending.pop_back();
+
+        for (const SubtreeInstance &c : cuts[w.shape]) {
+            double lp[DIM] = {c.P[0], c.P[1], c.P[2]}, lq[4] = {c.q[0], c.q[1], c.q[2], c.q[3]};
+            double cP[DIM], cq[4];
+            SubtreeInstance x = c;
+            qrot(q, lp, cP);
+            qmul(q, lq, cq);
+            for (int d = 0; d < DIM; d++)
+                x.P[d] = (float)(P[d] + w.scale * cP[d]);
+            for (int d = 0; d < 4; d++)
+                x.q[d] = (float)cq[d];
+            x.scale = w.scale * c.scale;
+            x.wscale = w.wscale * c.wscale;
+            pending.push_back(x);
+        }
+        w.shape = index[w.shape];
+        out.instances.push_back(w);
+    }
+}
+
+size_t SubtreeScene::choose_layout(size_t max_instances, SubtreeLayout &out) const {
+    std::vector<size_t> content, instances;
+    size_t best = 0, best_bytes = (size_t)-1;
+
+    if (shapes.empty()) {
+        out.clear();
+        return 0;
+    }
+
+    /* Sin cortes y luego umbrales de 1, 2, 4...; ante un empate queda el anterior */
+    size_t root = shapes.size() - 1;
+    for (size_t t = 0; t <= size(); t = t ? 2 * t : 1) {
+        size_t bytes = 0;
+
+        cut_sizes(t, content, instances);
+        for (size_t s = 0; s <= root; s++)
+            if (s == root || (t && shapes[s].total >= t))
+                bytes += content[s] * SEGMENT_BYTES + sizeof(LayoutShape);
+        bytes += instances[root] * sizeof(SubtreeInstance);
+        if (instances[root] <= max_instances && bytes < best_bytes) {
+            best = t;
+            best_bytes = bytes;
+        }
+    }
+    layout(best, out);
+    return best;
+}
@@ -0,0 +1,140 @@
+/**
+ * L-systems: instanciado de subárboles repetidos.
+ *
+ * Las ramas que coinciden salvo por una escala de largo y de grosor son
+ * la misma forma: cada forma se interpreta una vez y el árbol queda como
+ * un grafo acíclico de formas, que se dibuja como instancias.
+ */
+#ifndef SUBTREE_H
+#define SUBTREE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "lsystem.h"
+
+/* Instancias del corte por omisión, como las hojas de la BVH en render.h */
+#define SUBTREE_MAX_INSTANCES   2048
+
+/* Forma instanciada dentro de otra, relativa a la tortuga local de esta */
+typedef struct {
+    uint32_t shape;
+    uint32_t at;            /* segmentos propios de la forma que la preceden */
+    uint32_t parent;        /* padre local de su primer segmento, o NO_PARENT */
+    float P[DIM];
+    float q[4];             /* orientación, como en SegmentStore */
+    float scale;            /* largo relativo */
+    float wscale;           /* grosor relativo */
+} SubtreeChild;
+
+typedef struct {
+    uint32_t first;         /* segmentos propios [first, first + count) */
+    uint32_t count;
+    uint32_t child_first;   /* hijos [child_first, child_first + children) */
+    uint32_t children;
+    size_t total;           /* segmentos de la forma expandida */
+    size_t uses;            /* grupos de la descripción con esta forma */
+} SubtreeShape;
+
+/* Forma del corte: tramo de SubtreeLayout::segments y esfera envolvente local */
+typedef struct {
+    uint32_t first;
+    uint32_t count;
+    float center[DIM];
+    float radius;           /* de los extremos de los segmentos */
+    float wradius;          /* radio de cilindro más grueso */
+} LayoutShape;
+
+/* Instancia de una forma del corte en el mundo */
+typedef struct {
+    uint32_t shape;
+    float P[DIM];
+    float q[4];
+    float scale;
+    float wscale;
+} SubtreeInstance;
+
+/*
+ * Corte del grafo de formas para la GPU.  Los segmentos de cada forma son
+ * contiguos y van de mayor a menor grosor (para el nivel de detalle, ver
+ * render.h); su posición y orientación son locales.
+ */
+class SubtreeLayout {
+public:
+    SubtreeLayout() : threshold(0) {}
+
+    void clear();
+    /* Vacía el corte y devuelve su memoria */
+    void release();
+    /* Memoria de los segmentos, formas e instancias */
+    size_t bytes() const;
+
+    SegmentStore segments;
+    std::vector<LayoutShape> shapes;
+    std::vector<SubtreeInstance> instances;
+    size_t threshold;
+};
+
+class SubtreeScene {
+public:
+    SubtreeScene();
+
+    void clear();
+    /*
+     * Detecta las formas de los comandos, con los parámetros de 'tortuga'
+     * y el punto inicial P.  Por cada grupo entre corchetes balanceados se
+     * calcula su contenido normalizado: sus comandos con los largos
+     * divididos por el de su primer 'F' y los grosores por el de entrada
+     * (con los argumentos por omisión completados) y, en lugar de cada
+     * grupo interno, su número de forma con sus escalas relativas.  Dos
+     * grupos con el mismo contenido (mismo hash y mismas palabras) son la
+     * misma forma.  Los largos y grosores normalizados se comparan con 14
+     * bits de mantisa, así que una copia puede diferir de la original en
+     * una parte en 2^15.
+     *
+     * Cada forma se interpreta una vez con una tortuga local que parte del
+     * origen con T = F (ver segments.h: su orientación guardada parte de
+     * la identidad) y largo y grosor 1.  La raíz es lo que no está dentro
+     * de un grupo y es la última forma.
+     */
+    void build(const Token *cmds, size_t n, const LSystemInterpreter &tortuga, const double *P);
+    void build(const std::vector<Token> &cmds, const LSystemInterpreter &tortuga, const double *P);
+
+    /* Expande todas las formas: los mismos segmentos que read_desc */
+    void flatten(SegmentStore &out) const;
+    /* Corta en las formas con al menos 'threshold' segmentos (0: solo la raíz) */
+    void layout(size_t threshold, SubtreeLayout &out) const;
+    /*
+     * Elige el corte que ocupa menos memoria con a lo más 'max_instances'
+     * instancias (una llamada de dibujo por instancia y nivel de detalle)
+     * y lo deja en 'out'.  Prueba sin cortes y con umbrales de 1, 2, 4...:
+     * las formas con al menos ese número de segmentos son instancias y las
+     * más chicas se expanden dentro de la que las contiene.  Devuelve el
+     * umbral elegido.
+     */
+    size_t choose_layout(size_t max_instances, SubtreeLayout &out) const;
+
+    /* Segmentos del árbol expandido */
+    size_t size() const { return shapes.empty() ? 0 : shapes.back().total; }
+    /* Memoria de las formas, sus segmentos y sus hijos */
+    size_t bytes() const;
+    /* Memoria que ocuparían los segmentos expandidos en un SegmentStore */
+    size_t flat_bytes() const;
+
+    std::vector<SubtreeShape> shapes;
+    std::vector<SubtreeChild> children;
+    SegmentStore segments;
+    /* Grupos entre corchetes de la descripción */
+    size_t groups;
+    /* Posición y orientación inicial de la raíz */
+    double origin[DIM];
+    double rotation[4];
+
+private:
+    size_t expand(uint32_t s, const double P[DIM], const double q[4], double scale, double wscale,
+                  unsigned int parent, SegmentStore &out, size_t base,
+                  const std::vector<char> *cut, std::vector<SubtreeInstance> *cuts) const;
+    void cut_sizes(size_t threshold, std::vector<size_t> &content, std::vector<size_t> &instances) const;
+};
+
+#endif
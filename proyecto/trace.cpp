@@ -0,0 +1,109 @@
+/**
+ * L-systems: instrumentación de las etapas.
+ */
+#include "trace.h"
+
+#ifdef LSYSTEM_TRACE
+
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+std::atomic<uint64_t> trace_counters[TRACE_COUNTERS_MAX];
+
+static const char *COUNTER_NAMES[TRACE_COUNTERS_MAX] = {
+    "get_argument", "segmentos", "realocaciones", "bytes_realocados",
+    "cuadricas", "cilindros", "triangulos", "llamadas"
+};
+
+typedef struct {
+    const char *name;
+    char phase;             /* 'X': intervalo, 'C': contadores */
+    int tid;
+    double ts;              /* microsegundos desde el inicio */
+    double dur;
+    uint64_t counters[TRACE_COUNTERS_MAX];
+} TraceEvent;
+
+/* Eventos del programa; se escriben al destruirse (al salir, también con exit) */
+static struct TraceLog {
+    std::mutex lock;
+    std::vector<TraceEvent> events;
+    std::string path = "trace.json";
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    ~TraceLog();
+} trace_log;
+
+/* Número corto de hilo para el campo tid, en orden de aparición */
+static int trace_tid() {
+    static std::atomic<int> next(0);
+    static thread_local int tid = next++;
+    return tid;
+}
+
+double trace_now() {
+    return std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - trace_log.start).count();
+}
+
+void trace_open(const char *path) {
+    std::lock_guard<std::mutex> guard(trace_log.lock);
+    trace_log.path = path;
+}
+
+void trace_complete(const char *name, double start, double dur) {
+    TraceEvent e;
+    e.name = name;
+    e.phase = 'X';
+    e.tid = trace_tid();
+    e.ts = start;
+    e.dur = dur;
+
+    std::lock_guard<std::mutex> guard(trace_log.lock);
+    trace_log.events.push_back(e);
+}
+
+void trace_flush_counters(const char *name) {
+    TraceEvent e;
+    e.name = name;
+    e.phase = 'C';
+    e.tid = trace_tid();
+    e.ts = trace_now();
+    e.dur = 0;
+    for (int k = 0; k < TRACE_COUNTERS_MAX; k++)
+        e.counters[k] = trace_counters[k].exchange(0, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> guard(trace_log.lock);
+    trace_log.events.push_back(e);
+}
+
+TraceLog::~TraceLog() {
+    FILE *f = fopen(path.c_str(), "w");
+    if (!f) {
+        fprintf(stderr, "No se pudo escribir %s\n", path.c_str());
+        return;
+    }
+
+    fprintf(f, "{\"traceEvents\":[\n");
+    for (size_t i = 0; i < events.size(); i++) {
+        const TraceEvent &e = events[i];
+        fprintf(f, "{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":1,\"tid\":%d,\"ts\":%.3f",
+                e.name, e.phase, e.tid, e.ts);
+        if (e.phase == 'X')
+            fprintf(f, ",\"dur\":%.3f}", e.dur);
+        else {
+            fprintf(f, ",\"args\":{");
+            for (int k = 0; k < TRACE_COUNTERS_MAX; k++)
+                fprintf(f, "%s\"%s\":%llu", k ? "," : "", COUNTER_NAMES[k],
+                        (unsigned long long)e.counters[k]);
+            fprintf(f, "}}");
+        }
+        fprintf(f, "%s\n", i + 1 < events.size() ? "," : "");
+    }
+    fprintf(f, "],\"displayTimeUnit\":\"ms\"}\n");
+    fclose(f);
+}
+
+#endif
@@ -0,0 +1,77 @@
+/**
+ * L-systems: instrumentación de las etapas (solo al compilar con
+ * -DLSYSTEM_TRACE, ver make proyecto_trace).
+ *
+ * TRACE_SCOPE(nombre) mide el bloque en que aparece y TRACE_COUNT suma a
+ * uno de los contadores de TraceCounter.  TRACE_COUNTERS(nombre) registra
+ * los contadores acumulados desde la última vez (por ejemplo, los de un
+ * cuadro) y los vuelve a cero.  Al terminar el programa todo se escribe en
+ * formato Chrome trace (JSON), que se abre con chrome://tracing o
+ * https://ui.perfetto.dev; por omisión en trace.json, o en el archivo de
+ * TRACE_OPEN.
+ *
+ * Los tiempos son del lado de la CPU: una llamada de OpenGL puede volver
+ * antes de que la GPU termine, así que el dibujo se nota en el intervalo
+ * que espera el resultado (el glFinish de --headless o el cambio de buffer).
+ *
+ * Sin LSYSTEM_TRACE las macros no generan código.  Los nombres deben ser
+ * literales (se guarda el puntero).  Los contadores son atómicos, así que
+ * también sirven desde los hilos de parallel.h.
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <cstdint>
+
+typedef enum {
+    TRACE_GET_ARGUMENT,     /* llamadas a get_argument */
+    TRACE_SEGMENTS,         /* segmentos agregados a un SegmentStore */
+    TRACE_REALLOCS,         /* veces que un SegmentStore cambió de capacidad */
+    TRACE_REALLOC_BYTES,    /* memoria reservada en esos cambios */
+    TRACE_QUADRICS,         /* cuádricas de GLU dibujadas */
+    TRACE_CYLINDERS,        /* segmentos enviados a la GPU */
+    TRACE_TRIANGLES,        /* triángulos enviados a la GPU */
+    TRACE_DRAW_CALLS,
+    TRACE_COUNTERS_MAX
+} TraceCounter;
+
+#ifdef LSYSTEM_TRACE
+
+#include <atomic>
+#include <chrono>
+
+extern std::atomic<uint64_t> trace_counters[TRACE_COUNTERS_MAX];
+
+void trace_open(const char *path);
+/* Registra un intervalo [start, start + dur) en microsegundos desde el inicio */
+void trace_complete(const char *name, double start, double dur);
+void trace_flush_counters(const char *name);
+double trace_now();
+
+class TraceScope {
+public:
+    explicit TraceScope(const char *name) : name(name), start(trace_now()) {}
+    ~TraceScope() { trace_complete(name, start, trace_now() - start); }
+
+private:
+    const char *name;
+    double start;
+};
+
+#define TRACE_JOIN2(a, b)       a##b
+#define TRACE_JOIN(a, b)        TRACE_JOIN2(a, b)
+#define TRACE_SCOPE(name)       TraceScope TRACE_JOIN(trace_scope_, __LINE__)(name)
+#define TRACE_COUNT(c, n)       trace_counters[c].fetch_add((uint64_t)(n), std::memory_order_relaxed)
+#define TRACE_COUNTERS(name)    trace_flush_counters(name)
+#define TRACE_OPEN(path)        trace_open(path)
+
+#else
+
+#define TRACE_SCOPE(name)       ((void)0)
+#define TRACE_COUNT(c, n)       ((void)0)
+#define TRACE_COUNTERS(name)    ((void)0)
+#define TRACE_OPEN(path)        ((void)(path))
+
+#endif
+
+#endif
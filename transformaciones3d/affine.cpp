@@ -0,0 +1,29 @@
+#include <cmath>
+#include "affine.h"
+
+#define PI 3.14159265
+
+Affine3 &Affine3::rotateDeg(Axis axis, double deg) {
+    double theta = deg * PI / 180.0;
+    return rotate(axis, cos(theta), sin(theta));
+}
+
+int matrixCellWidth(const Mat4 &M, bool *scientific) {
+    bool wide = false;
+
+    /* Same layouts as armadillo: 9 columns, 10 from 10 up, 13 in scientific. */
+    *scientific = false;
+    for (int r = 0; r < 4; r++)
+        for (int c = 0; c < 4; c++) {
+            double v = M(r, c), a = std::fabs(v);
+            if (!std::isfinite(v))
+                continue;
+            if (a >= 100 || (a > 0 && a <= 1e-4)) {
+                *scientific = true;
+                return 13;
+            }
+            if (a >= 10)
+                wide = true;
+        }
+    return wide ? 10 : 9;
+}
@@ -0,0 +1,140 @@
+/*
+ * Fixed-size matrices for composite transforms.
+ *
+ * Mat4 is a plain 4x4 matrix.  Affine3 keeps only what an affine transform
+ * needs: the 3x3 linear part L and the translation t (the bottom row is
+ * always 0 0 0 1).  Both live on the stack and every operation is
+ * constexpr, so a chain of transforms composes without allocating.
+ *
+ * translate(), scale() and rotate() right-multiply by the elementary
+ * matrix in closed form (A = A * B), the same order getCompositeMatrix
+ * uses: a translation only touches t, a scale only multiplies columns of
+ * L and a rotation only mixes two columns.  Since the skipped terms are
+ * products with 0 and 1, the result is the same as the full product.
+ */
+#ifndef AFFINE_H
+#define AFFINE_H
+
+enum Axis { AXIS_X, AXIS_Y, AXIS_Z };
+
+struct Mat4 {
+    double m[4][4];
+
+    static constexpr Mat4 identity() {
+        Mat4 I = {};
+        for (int i = 0; i < 4; i++)
+            I.m[i][i] = 1;
+        return I;
+    }
+
+    constexpr double operator()(int r, int c) const { return m[r][c]; }
+
+    constexpr Mat4 operator*(const Mat4 &B) const {
+        Mat4 P = {};
+        for (int r = 0; r < 4; r++)
+            for (int c = 0; c < 4; c++) {
+                double sum = 0;
+                for (int k = 0; k < 4; k++)
+                    sum += m[r][k] * B.m[k][c];
+                P.m[r][c] = sum;
+            }
+        return P;
+    }
+};
+
+struct Affine3 {
+    double L[3][3];
+    double t[3];
+
+    static constexpr Affine3 identity() {
+        Affine3 A = {};
+        for (int i = 0; i < 3; i++)
+            A.L[i][i] = 1;
+        return A;
+    }
+
+    static constexpr Affine3 translation(double x, double y, double z) {
+        return identity().translate(x, y, z);
+    }
+
+    static constexpr Affine3 scaling(double x, double y, double z) {
+        return identity().scale(x, y, z);
+    }
+
+    /* Rotation about an axis given the cosine and sine of the angle. */
+    static constexpr Affine3 rotation(Axis axis, double c, double s) {
+        return identity().rotate(axis, c, s);
+    }
+
+    /* A = A * translation(x, y, z) */
+    constexpr Affine3 &translate(double x, double y, double z) {
+        for (int r = 0; r < 3; r++)
+            t[r] = L[r][0] * x + L[r][1] * y + L[r][2] * z + t[r];
+        return *this;
+    }
+
+    /* A = A * scaling(x, y, z) */
+    constexpr Affine3 &scale(double x, double y, double z) {
+        for (int r = 0; r < 3; r++) {
+            L[r][0] *= x;
+            L[r][1] *= y;
+            L[r][2] *= z;
+        }
+        return *this;
+    }
+
+    /*
+     * A = A * rotation(axis, c, s).  The rotation mixes the other two
+     * columns (a, b) in cyclic order: (y, z), (z, x) or (x, y).
+     */
+    constexpr Affine3 &rotate(Axis axis, double c, double s) {
+        int a = axis == AXIS_X ? 1 : axis == AXIS_Y ? 2 : 0;
+        int b = axis == AXIS_X ? 2 : axis == AXIS_Y ? 0 : 1;
+        for (int r = 0; r < 3; r++) {
+            double ca = L[r][a], cb = L[r][b];
+            L[r][a] = ca * c + cb * s;
+            L[r][b] = ca * -s + cb * c;
+        }
+        return *this;
+    }
+
+    /* Same as rotate(), with the angle in degrees. */
+    Affine3 &rotateDeg(Axis axis, double deg);
+
+    constexpr Affine3 operator*(const Affine3 &B) const {
+        Affine3 P = {};
+        for (int r = 0; r < 3; r++) {
+            for (int c = 0; c < 3; c++)
+                P.L[r][c] = L[r][0] * B.L[0][c] + L[r][1] * B.L[1][c] + L[r][2] * B.L[2][c];
+            P.t[r] = L[r][0] * B.t[0] + L[r][1] * B.t[1] + L[r][2] * B.t[2] + t[r];
+        }
+        return P;
+    }
+
+    constexpr Mat4 toMat4() const {
+        Mat4 M = Mat4::identity();
+        for (int r = 0; r < 3; r++) {
+            for (int c = 0; c < 3; c++)
+                M.m[r][c] = L[r][c];
+            M.m[r][3] = t[r];
+        }
+        return M;
+    }
+
+    /* Top three rows, as transformBatch (batch.h) takes them. */
+    constexpr void rows(double M[3][4]) const {
+        for (int r = 0; r < 3; r++) {
+            for (int c = 0; c < 3; c++)
+                M[r][c] = L[r][c];
+            M[r][3] = t[r];
+        }
+    }
+};
+
+/*
+ * Cell width arma::mat::print() would use for M: all cells get the same
+ * width and 4 decimals, fixed or, if any value needs it, scientific.
+ */
+int matrixCellWidth(const Mat4 &M, bool *scientific);
+
+#endif
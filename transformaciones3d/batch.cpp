@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include "batch.h"
+
+#if defined(__AVX512F__) || (defined(__AVX2__) && defined(__FMA__))
+#include <immintrin.h>
+#endif
+
+/* Points per thread below which adding a thread does not pay off. */
+#define MIN_POINTS_PER_THREAD (1 << 16)
+/* Block boundaries are multiples of this, so only the last block has a tail. */
+#define BLOCK_ALIGN 64
+
+#if defined(__AVX512F__)
+
+void transformBatch(const double M[3][4], const double *x, const double *y, const double *z,
+                    double *ox, double *oy, double *oz, size_t n) {
+    __m512d m[3][4];
+    double *out[3] = {ox, oy, oz};
+    size_t i = 0;
+
+    for (int r = 0; r < 3; r++)
+        for (int c = 0; c < 4; c++)
+            m[r][c] = _mm512_set1_pd(M[r][c]);
+
+    for (; i + 8 <= n; i += 8) {
+        __m512d vx = _mm512_loadu_pd(x + i);
+        __m512d vy = _mm512_loadu_pd(y + i);
+        __m512d vz = _mm512_loadu_pd(z + i);
+        __m512d res[3];
+        for (int r = 0; r < 3; r++) {
+            res[r] = _mm512_fmadd_pd(m[r][2], vz, m[r][3]);
+            res[r] = _mm512_fmadd_pd(m[r][1], vy, res[r]);
+            res[r] = _mm512_fmadd_pd(m[r][0], vx, res[r]);
+        }
+        for (int r = 0; r < 3; r++)
+            _mm512_storeu_pd(out[r] + i, res[r]);
+    }
+
+    /* Tail: the same operations on a masked vector. */
+    if (i < n) {
+        __mmask8 k = (__mmask8)((1u << (n - i)) - 1);
+        __m512d vx = _mm512_maskz_loadu_pd(k, x + i);
+        __m512d vy = _mm512_maskz_loadu_pd(k, y + i);
+        __m512d vz = _mm512_maskz_loadu_pd(k, z + i);
+        __m512d res[3];
+        for (int r = 0; r < 3; r++) {
+            res[r] = _mm512_fmadd_pd(m[r][2], vz, m[r][3]);
+            res[r] = _mm512_fmadd_pd(m[r][1], vy, res[r]);
+            res[r] = _mm512_fmadd_pd(m[r][0], vx, res[r]);
+        }
+        for (int r = 0; r < 3; r++)
+            _mm512_mask_storeu_pd(out[r] + i, k, res[r]);
+    }
+}
+
+void transformBatch(const double M[3][4], const float *x, const float *y, const float *z,
+                    float *ox, float *oy, float *oz, size_t n) {
+    __m512 m[3][4];
+    float *out[3] = {ox, oy, oz};
+    size_t i = 0;
+
+    for (int r = 0; r < 3; r++)
+        for (int c = 0; c < 4; c++)
+            m[r][c] = _mm512_set1_ps((float)M[r][c]);
+
+    for (; i + 16 <= n; i += 16) {
+        __m512 vx = _mm512_loadu_ps(x + i);
+        __m512 vy = _mm512_loadu_ps(y + i);
+        __m512 vz = _mm512_loadu_ps(z + i);
+        __m512 res[3];
+        for (int r = 0; r < 3; r++) {
+            res[r] = _mm512_fmadd_ps(m[r][2], vz, m[r][3]);
+            res[r] = _mm512_fmadd_ps(m[r][1], vy, res[r]);
+            res[r] = _mm512_fmadd_ps(m[r][0], vx, res[r]);
+        }
+        for (int r = 0; r < 3; r++)
+            _mm512_storeu_ps(out[r] + i, res[r]);
+    }
+
+    if (i < n) {
+        __mmask16 k = (__mmask16)((1u << (n - i)) - 1);
+        __m512 vx = _mm512_maskz_loadu_ps(k, x + i);
+        __m512 vy = _mm512_maskz_loadu_ps(k, y + i);
+        __m512 vz = _mm512_maskz_loadu_ps(k, z + i);
+        __m512 res[3];
+        for (int r = 0; r < 3; r++) {
+            res[r] = _mm512_fmadd_ps(m[r][2], vz, m[r][3]);
+            res[r] = _mm512_fmadd_ps(m[r][1], vy, res[r]);
+            res[r] = _mm512_fmadd_ps(m[r][0], vx, res[r]);
+        }
+        for (int r = 0; r < 3; r++)
+            _mm512_mask_storeu_ps(out[r] + i, k, res[r]);
+    }
+}
+
+#elif defined(__AVX2__) && defined(__FMA__)
+
+void transformBatch(const double M[3][4], const double *x, const double *y, const double *z,
+                    double *ox, double *oy, double *oz, size_t n) {
+    __m256d m[3][4];
+    double *out[3] = {ox, oy, oz};
+    size_t i = 0;
+
+    for (int r = 0; r < 3; r++)
+        for (int c = 0; c < 4; c++)
+            m[r][c] = _mm256_set1_pd(M[r][c]);
+
+    for (; i + 4 <= n; i += 4) {
+        __m256d vx = _mm256_loadu_pd(x + i);
+        __m256d vy = _mm256_loadu_pd(y + i);
+        __m256d vz = _mm256_loadu_pd(z + i);
+        __m256d res[3];
+        for (int r = 0; r < 3; r++) {
+            res[r] = _mm256_fmadd_pd(m[r][2], vz, m[r][3]);
+            res[r] = _mm256_fmadd_pd(m[r][1], vy, res[r]);
+            res[r] = _mm256_fmadd_pd(m[r][0], vx, res[r]);
+        }
+        for (int r = 0; r < 3; r++)
+            _mm256_storeu_pd(out[r] + i, res[r]);
+    }
+
+    /* Tail: std::fma compiles to the same instruction with -mfma. */
+    for (; i < n; i++) {
+        double vx = x[i], vy = y[i], vz = z[i];
+        for (int r = 0; r < 3; r++)
+            out[r][i] = std::fma(M[r][0], vx, std::fma(M[r][1], vy, std::fma(M[r][2], vz, M[r][3])));
+    }
+}
+
+void transformBatch(const double M[3][4], const float *x, const float *y, const float *z,
+                    float *ox, float *oy, float *oz, size_t n) {
+    __m256 m[3][4];
+    float Mf[3][4];
+    float *out[3] = {ox, oy, oz};
+    size_t i = 0;
+
+    for (int r = 0; r < 3; r++)
+        for (int c = 0; c < 4; c++) {
+            Mf[r][c] = (float)M[r][c];
+            m[r][c] = _mm256_set1_ps(Mf[r][c]);
+        }
+
+    for (; i + 8 <= n; i += 8) {
+        __m256 vx = _mm256_loadu_ps(x + i);
+        __m256 vy = _mm256_loadu_ps(y + i);
+        __m256 vz = _mm256_loadu_ps(z + i);
+        __m256 res[3];
+        for (int r = 0; r < 3; r++) {
+            res[r] = _mm256_fmadd_ps(m[r][2], vz, m[r][3]);
+            res[r] = _mm256_fmadd_ps(m[r][1], vy, res[r]);
+            res[r] = _mm256_fmadd_ps(m[r][0], vx, res[r]);
+        }
+        for (int r = 0; r < 3; r++)
+            _mm256_storeu_ps(out[r] + i, res[r]);
+    }
+
+    for (; i < n; i++) {
+        float vx = x[i], vy = y[i], vz = z[i];
+        for (int r = 0; r < 3; r++)
+            out[r][i] = std::fma(Mf[r][0], vx, std::fma(Mf[r][1], vy, std::fma(Mf[r][2], vz, Mf[r][3])));
+    }
+}
+
+#else
+
+/* Plain loop; the compiler vectorizes it with whatever the target has. */
+template <typename Real>
+static void transformScalar(const double M[3][4], const Real *x, const Real *y, const Real *z,
+                            Real *ox, Real *oy, Real *oz, size_t n) {
+    const Real m00 = (Real)M[0][0], m01 = (Real)M[0][1], m02 = (Real)M[0][2], m03 = (Real)M[0][3];
+    const Real m10 = (Real)M[1][0], m11 = (Real)M[1][1], m12 = (Real)M[1][2], m13 = (Real)M[1][3];
+    const Real m20 = (Real)M[2][0], m21 = (Real)M[2][1], m22 = (Real)M[2][2], m23 = (Real)M[2][3];
+
+    for (size_t i = 0; i < n; i++) {
+        Real vx = x[i], vy = y[i], vz = z[i];
+        ox[i] = m00 * vx + m01 * vy + m02 * vz + m03;
+        oy[i] = m10 * vx + m11 * vy + m12 * vz + m13;
+        oz[i] = m20 * vx + m21 * vy + m22 * vz + m23;
+    }
+}
+
+void transformBatch(const double M[3][4], const double *x, const double *y, const double *z,
+                    double *ox, double *oy, double *oz, size_t n) {
+    transformScalar(M, x, y, z, ox, oy, oz, n);
+}
+
+void transformBatch(const double M[3][4], const float *x, const float *y, const float *z,
+                    float *ox, float *oy, float *oz, size_t n) {
+    transformScalar(M, x, y, z, ox, oy, oz, n);
+}
+
+#endif
+
+template <typename Real>
+static void transformParallel(const double M[3][4], const PointArrays<Real> &in,
+                              PointArrays<Real> &out, unsigned threads) {
+    size_t n = in.size();
+
+    out.resize(n);
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = (unsigned)std::min<size_t>(threads, n / MIN_POINTS_PER_THREAD + 1);
+
+    size_t block = (n / threads + BLOCK_ALIGN - 1) / BLOCK_ALIGN * BLOCK_ALIGN;
+    auto work = [&](size_t first) {
+        size_t count = std::min(block, n - first);
+        transformBatch(M, &in.x[first], &in.y[first], &in.z[first],
+                       &out.x[first], &out.y[first], &out.z[first], count);
+    };
+
+    /* The calling thread takes the first block. */
+    std::vector<std::thread> pool;
+    for (size_t first = block; first < n; first += block)
+        pool.emplace_back(work, first);
+    if (n > 0)
+        work(0);
+    for (std::thread &t : pool)
+        t.join();
+}
+
+void transformBatchParallel(const double M[3][4], const PointArrays<double> &in,
+                            PointArrays<double> &out, unsigned threads) {
+    transformParallel(M, in, out, threads);
+}
+
+void transformBatchParallel(const double M[3][4], const PointArrays<float> &in,
+                            PointArrays<float> &out, unsigned threads) {
+    transformParallel(M, in, out, threads);
+}
@@ -0,0 +1,64 @@
+/*
+ * Batch transformation of point clouds.
+ *
+ * Points are stored as a structure of arrays (one array per coordinate) so
+ * the kernel can load 8 or 16 coordinates at once.  Only the top three rows
+ * of the composite matrix are used: the bottom row of an affine transform
+ * is always (0, 0, 0, 1), so w stays 1 and never has to be computed.
+ *
+ * The kernel is chosen at compile time: AVX-512 if __AVX512F__ is defined,
+ * AVX2 with FMA if __AVX2__ and __FMA__ are, and a plain loop otherwise
+ * (see ARCH in the Makefile).  The vector kernels use fused multiply-adds
+ * for every point, including the tail, so the result does not depend on
+ * where a point falls in the array or on how the array is split between
+ * threads.
+ */
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <cstddef>
+#include <vector>
+
+template <typename Real>
+struct PointArrays {
+    std::vector<Real> x;
+    std::vector<Real> y;
+    std::vector<Real> z;
+
+    void resize(size_t n) {
+        x.resize(n);
+        y.resize(n);
+        z.resize(n);
+    }
+    size_t size() const { return x.size(); }
+};
+
+/*
+ * Writes M * (x, y, z, 1) for the first n points into (ox, oy, oz), which
+ * must already hold n values.  The output may be the input itself.  With
+ * float points the matrix is rounded to float first.
+ */
+void transformBatch(const double M[3][4], const double *x, const double *y, const double *z,
+                    double *ox, double *oy, double *oz, size_t n);
+void transformBatch(const double M[3][4], const float *x, const float *y, const float *z,
+                    float *ox, float *oy, float *oz, size_t n);
+
+/* Same as above on whole arrays; out is resized to in.size() if needed. */
+template <typename Real>
+void transformBatch(const double M[3][4], const PointArrays<Real> &in, PointArrays<Real> &out) {
+    out.resize(in.size());
+    transformBatch(M, in.x.data(), in.y.data(), in.z.data(),
+                   out.x.data(), out.y.data(), out.z.data(), in.size());
+}
+
+/*
+ * Splits the points in contiguous blocks between 'threads' threads (0: one
+ * per core).  Small inputs use fewer threads.  The result is identical to
+ * transformBatch.
+ */
+void transformBatchParallel(const double M[3][4], const PointArrays<double> &in,
+                            PointArrays<double> &out, unsigned threads);
+void transformBatchParallel(const double M[3][4], const PointArrays<float> &in,
+                            PointArrays<float> &out, unsigned threads);
+
+#endif
@@ -0,0 +1,343 @@
+/**
+ * Benchmarks of the batch point transformation, of parsing and composing
+ * chains of transforms and of the streaming batch mode (Google Benchmark).
+ *
+ * To build: make bench
+ * To run:   ./bench
+ */
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "affine.h"
+#include "batch.h"
+#include "cases.h"
+#include "ops.h"
+
+#define PI 3.14159265
+
+struct Point {
+    double x;
+    double y;
+    double z;
+};
+
+/* Top rows of t(1, 2, 3) * rz(30) * s(2, 2, 2), as getCompositeMatrix would build it. */
+static void compositeMatrix(double M[3][4]) {
+    double c = cos(30 * PI / 180.0), s = sin(30 * PI / 180.0);
+    double rows[3][4] = { {2 * c, -2 * s, 0, 1},
+                          {2 * s, 2 * c, 0, 2},
+                          {0, 0, 2, 3} };
+    for (int r = 0; r < 3; r++)
+        for (int k = 0; k < 4; k++)
+            M[r][k] = rows[r][k];
+}
+
+template <typename Real>
+static void randomPoints(size_t n, PointArrays<Real> &points) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> dist(-100.0, 100.0);
+
+    points.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        points.x[i] = (Real)dist(rng);
+        points.y[i] = (Real)dist(rng);
+        points.z[i] = (Real)dist(rng);
+    }
+}
+
+static void setCounters(benchmark::State &state, size_t n, size_t bytesPerPoint) {
+    state.counters["points/s"] = benchmark::Counter(
+        (double)n * state.iterations(), benchmark::Counter::kIsRate);
+    state.SetBytesProcessed((int64_t)(n * bytesPerPoint) * state.iterations());
+}
+
+/* Reference: array of Point and the full 4x4 product per point, as transform() did. */
+static void BM_transform_aos(benchmark::State &state) {
+    size_t n = state.range(0);
+    double M[3][4], T[4][4] = {};
+    PointArrays<double> soa;
+    std::vector<Point> points(n), res(n);
+
+    compositeMatrix(M);
+    for (int r = 0; r < 3; r++)
+        for (int c = 0; c < 4; c++)
+            T[r][c] = M[r][c];
+    T[3][3] = 1;
+    randomPoints(n, soa);
+    for (size_t i = 0; i < n; i++)
+        points[i] = {soa.x[i], soa.y[i], soa.z[i]};
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; i++) {
+            double v[4] = {points[i].x, points[i].y, points[i].z, 1}, p[4];
+            for (int r = 0; r < 4; r++)
+                p[r] = T[r][0] * v[0] + T[r][1] * v[1] + T[r][2] * v[2] + T[r][3] * v[3];
+            res[i] = {p[0], p[1], p[2]};
+        }
+        benchmark::DoNotOptimize(res.data());
+        benchmark::ClobberMemory();
+    }
+    setCounters(state, n, 2 * sizeof(Point));
+}
+BENCHMARK(BM_transform_aos)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+template <typename Real>
+static void BM_transform_batch(benchmark::State &state) {
+    size_t n = state.range(0);
+    double M[3][4];
+    PointArrays<Real> in, out;
+
+    compositeMatrix(M);
+    randomPoints(n, in);
+    out.resize(n);
+    for (auto _ : state) {
+        transformBatch(M, in, out);
+        benchmark::DoNotOptimize(out.x.data());
+        benchmark::ClobberMemory();
+    }
+    setCounters(state, n, 6 * sizeof(Real));
+}
+BENCHMARK_TEMPLATE(BM_transform_batch, double)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_transform_batch, float)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+/* range(0) points, range(1) threads; wall time, since the work is on other threads */
+template <typename Real>
+static void BM_transform_parallel(benchmark::State &state) {
+    size_t n = state.range(0);
+    double M[3][4];
+    PointArrays<Real> in, out;
+
+    compositeMatrix(M);
+    randomPoints(n, in);
+    out.resize(n);
+    for (auto _ : state) {
+        transformBatchParallel(M, in, out, (unsigned)state.range(1));
+        benchmark::DoNotOptimize(out.x.data());
+        benchmark::ClobberMemory();
+    }
+    setCounters(state, n, 6 * sizeof(Real));
+}
+BENCHMARK_TEMPLATE(BM_transform_parallel, double)
+    ->ArgsProduct({{1 << 20, 1 << 24}, {1, 2, 4, 8}})->UseRealTime();
+BENCHMARK_TEMPLATE(BM_transform_parallel, float)
+    ->ArgsProduct({{1 << 20, 1 << 24}, {1, 2, 4, 8}})->UseRealTime();
+
+/* The composite matrix can be built at compile time */
+static constexpr Affine3 CONSTANT_CHAIN =
+    Affine3::translation(1, 2, 3) * Affine3::scaling(2, 2, 2) * Affine3::rotation(AXIS_Z, 0, 1);
+static_assert(CONSTANT_CHAIN.L[0][1] == -2 && CONSTANT_CHAIN.t[2] == 3, "constexpr composition");
+
+static std::vector<TransformOp> randomChain(size_t n) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> dist(-2.0, 2.0);
+    std::vector<TransformOp> chain(n);
+
+    for (TransformOp &op : chain) {
+        op.kind = (OpKind)(rng() % 3);
+        op.axis = op.kind == OP_ROTATE ? (Axis)(rng() % 3) : AXIS_X;
+        for (double &v : op.p)
+            v = op.kind == OP_ROTATE ? 90 * dist(rng) : dist(rng);
+        if (op.kind == OP_ROTATE)
+            op.p[1] = op.p[2] = 0;
+    }
+    return chain;
+}
+
+/* The chain as a script, one transformation per line */
+static std::string chainScript(const std::vector<TransformOp> &chain) {
+    std::ostringstream out;
+
+    out.precision(17);
+    for (const TransformOp &op : chain) {
+        if (op.kind == OP_ROTATE)
+            out << "r " << "xyz"[op.axis] << " " << op.p[0] << "\n";
+        else
+            out << (op.kind == OP_TRANSLATE ? "t " : "s ")
+                << op.p[0] << " " << op.p[1] << " " << op.p[2] << "\n";
+    }
+    return out.str();
+}
+
+static void setChainCounters(benchmark::State &state, size_t n) {
+    state.counters["transforms/s"] = benchmark::Counter(
+        (double)n * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+static Mat4 stepMatrix(const TransformOp &op) {
+    Mat4 B = Mat4::identity();
+    if (op.kind == OP_TRANSLATE) {
+        for (int r = 0; r < 3; r++)
+            B.m[r][3] = op.p[r];
+    } else if (op.kind == OP_SCALE) {
+        for (int r = 0; r < 3; r++)
+            B.m[r][r] = op.p[r];
+    } else {
+        B = Affine3::identity().rotateDeg(op.axis, op.p[0]).toMat4();
+    }
+    return B;
+}
+
+/* Dynamically sized matrices: a new heap buffer for every factor and product */
+static void BM_chain_dynamic(benchmark::State &state) {
+    std::vector<TransformOp> chain = randomChain(state.range(0));
+
+    for (auto _ : state) {
+        std::vector<double> T(16, 0.0);
+        for (int i = 0; i < 4; i++)
+            T[4 * i + i] = 1;
+        for (size_t i = chain.size(); i-- > 0; ) {
+            Mat4 S = stepMatrix(chain[i]);
+            std::vector<double> B(&S.m[0][0], &S.m[0][0] + 16), P(16);
+            for (int r = 0; r < 4; r++)
+                for (int c = 0; c < 4; c++) {
+                    double sum = 0;
+                    for (int k = 0; k < 4; k++)
+                        sum += T[4 * r + k] * B[4 * k + c];
+                    P[4 * r + c] = sum;
+                }
+            T = P;
+        }
+        benchmark::DoNotOptimize(T.data());
+    }
+    setChainCounters(state, chain.size());
+}
+BENCHMARK(BM_chain_dynamic)->RangeMultiplier(10)->Range(10, 10000);
+
+/* Full 4x4 products on the stack */
+static void BM_chain_mat4(benchmark::State &state) {
+    std::vector<TransformOp> chain = randomChain(state.range(0));
+
+    for (auto _ : state) {
+        Mat4 T = Mat4::identity();
+        for (size_t i = chain.size(); i-- > 0; )
+            T = T * stepMatrix(chain[i]);
+        benchmark::DoNotOptimize(T);
+    }
+    setChainCounters(state, chain.size());
+}
+BENCHMARK(BM_chain_mat4)->RangeMultiplier(10)->Range(10, 10000);
+
+/* Closed-form products with Affine3 (getCompositeMatrix) */
+static void BM_chain_affine(benchmark::State &state) {
+    std::vector<TransformOp> chain = randomChain(state.range(0));
+
+    for (auto _ : state) {
+        Affine3 T = getCompositeMatrix(chain);
+        benchmark::DoNotOptimize(T);
+    }
+    setChainCounters(state, chain.size());
+}
+BENCHMARK(BM_chain_affine)->RangeMultiplier(10)->Range(10, 10000);
+
+/*
+ * Parsing a script the way process() used to: a vector of strings and a
+ * vector of numbers per transformation, compared by string.
+ */
+static void BM_parse_strings(benchmark::State &state) {
+    std::string script = chainScript(randomChain(state.range(0)));
+    size_t count = 0;
+
+    for (auto _ : state) {
+        std::istringstream in(script);
+        std::vector<std::pair<std::vector<std::string>, std::vector<double>>> ops;
+        std::string name;
+        while (in >> name) {
+            std::pair<std::vector<std::string>, std::vector<double>> op;
+            double c;
+            op.first.push_back(name);
+            if (name == "r") {
+                std::string axis;
+                in >> axis >> c;
+                op.first.push_back(axis);
+                op.second.push_back(c);
+            } else {
+                for (int k = 0; k < 3 && in >> c; k++)
+                    op.second.push_back(c);
+            }
+            ops.push_back(op);
+        }
+        count = ops.size();
+        benchmark::DoNotOptimize(ops.data());
+    }
+    setChainCounters(state, count);
+    state.SetBytesProcessed((int64_t)script.size() * state.iterations());
+}
+BENCHMARK(BM_parse_strings)->RangeMultiplier(100)->Range(100, 1000000);
+
+/* readOps straight from the buffer into TransformOp, then compose */
+static void BM_parse_ops(benchmark::State &state) {
+    std::string script = chainScript(randomChain(state.range(0)));
+    std::vector<TransformOp> ops;
+
+    for (auto _ : state) {
+        ops.clear();
+        readOps(script.data(), script.data() + script.size(), ops);
+        Affine3 T = getCompositeMatrix(ops);
+        benchmark::DoNotOptimize(T);
+    }
+    setChainCounters(state, ops.size());
+    state.SetBytesProcessed((int64_t)script.size() * state.iterations());
+}
+BENCHMARK(BM_parse_ops)->RangeMultiplier(100)->Range(100, 1000000);
+
+/*
+ * The whole batch mode (read, solve, format and write) on range(0) cases
+ * from generateCases, from memory to /dev/null: cases/s should not depend
+ * on the number of cases.
+ */
+static void BM_batch_cases(benchmark::State &state) {
+    char *text = NULL;
+    size_t size = 0;
+    size_t cases = state.range(0);
+    FILE *gen = open_memstream(&text, &size);
+
+    generateCases(gen, cases, 4, 3, 1);
+    fclose(gen);
+    FILE *null = fopen("/dev/null", "w");
+
+    for (auto _ : state) {
+        FILE *in = fmemopen(text, size, "r");
+        benchmark::DoNotOptimize(processBatch(in, null, NULL));
+        fclose(in);
+    }
+    fclose(null);
+    free(text);
+    state.counters["cases/s"] = benchmark::Counter(
+        (double)cases * state.iterations(), benchmark::Counter::kIsRate);
+    state.SetBytesProcessed((int64_t)size * state.iterations());
+}
+BENCHMARK(BM_batch_cases)->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMillisecond);
+
+/*
+ * processBatchParallel on 1<<16 cases with range(0) threads (1 is
+ * processBatch), to compare against BM_batch_cases.
+ */
+static void BM_batch_cases_parallel(benchmark::State &state) {
+    char *text = NULL;
+    size_t size = 0;
+    size_t cases = 1 << 16;
+    FILE *gen = open_memstream(&text, &size);
+
+    generateCases(gen, cases, 4, 3, 1);
+    fclose(gen);
+    FILE *null = fopen("/dev/null", "w");
+
+    for (auto _ : state) {
+        FILE *in = fmemopen(text, size, "r");
+        benchmark::DoNotOptimize(processBatchParallel(in, null, state.range(0), NULL));
+        fclose(in);
+    }
+    fclose(null);
+    free(text);
+    state.counters["cases/s"] = benchmark::Counter(
+        (double)cases * state.iterations(), benchmark::Counter::kIsRate);
+    state.SetBytesProcessed((int64_t)size * state.iterations());
+}
+BENCHMARK(BM_batch_cases_parallel)->RangeMultiplier(2)->Range(1, 8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
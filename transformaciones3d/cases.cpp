@@ -0,0 +1,378 @@
+#include <algorithm>
+#include <charconv>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <thread>
+#include "cases.h"
+
+CaseReader::CaseReader(FILE *in)
+    : in(in), buf(READ_CHUNK + READ_LOOKAHEAD), begin(0), end(0), eof(false) {}
+
+/* Makes at least n bytes available from begin, unless the input ends first. */
+void CaseReader::fill(size_t n) {
+    if (end - begin >= n || eof)
+        return;
+
+    memmove(buf.data(), buf.data() + begin, end - begin);
+    end -= begin;
+    begin = 0;
+    while (end < n && !eof) {
+        size_t got = fread(buf.data() + end, 1, buf.size() - end, in);
+        if (got == 0)
+            eof = true;
+        end += got;
+    }
+}
+
+/* Whitespace can be longer than the lookahead (blank lines), so refill while skipping it. */
+void CaseReader::skipSpaces() {
+    for (;;) {
+        while (begin < end && (buf[begin] == ' ' || buf[begin] == '\n' || buf[begin] == '\t' ||
+                               buf[begin] == '\r' || buf[begin] == '\v' || buf[begin] == '\f'))
+            begin++;
+        if (begin < end || eof)
+            return;
+        fill(1);
+    }
+}
+
+bool CaseReader::readInt(int &v) {
+    skipSpaces();
+    fill(READ_LOOKAHEAD);
+    std::from_chars_result res = std::from_chars(buf.data() + begin, buf.data() + end, v);
+    if (res.ec != std::errc())
+        return false;
+    begin = res.ptr - buf.data();
+    return true;
+}
+
+bool CaseReader::readNumber(double &v) {
+    skipSpaces();
+    fill(READ_LOOKAHEAD);
+    const char *p = buf.data() + begin;
+    if (!::readNumber(&p, buf.data() + end, v))
+        return false;
+    begin = p - buf.data();
+    return true;
+}
+
+bool CaseReader::readOp(TransformOp &op) {
+    skipSpaces();
+    fill(READ_LOOKAHEAD);
+    const char *p = buf.data() + begin;
+    if (!::readOp(&p, buf.data() + end, op))
+        return false;
+    begin = p - buf.data();
+    return true;
+}
+
+bool CaseReader::next(TransformCase &c) {
+    int n, t;
+
+    if (!readInt(n) || !readInt(t) || n < 0 || t < 0)
+        return false;
+
+    c.points.resize(n);
+    for (int i = 0; i < n; i++)
+        if (!readNumber(c.points.x[i]) || !readNumber(c.points.y[i]) || !readNumber(c.points.z[i]))
+            return false;
+
+    bool pivot = false;
+    if (n > 0) {
+        pivot = true;
+        for (int i = 0; i < n && pivot; i++)
+            if (c.points.x[i] == 0 && c.points.y[i] == 0 && c.points.z[i] == 0)
+                pivot = false;
+    }
+    double x0 = n > 0 ? c.points.x[0] : 0;
+    double y0 = n > 0 ? c.points.y[0] : 0;
+    double z0 = n > 0 ? c.points.z[0] : 0;
+
+    c.ops.clear();
+    for (int i = 0; i < t; i++) {
+        TransformOp op;
+        if (!readOp(op))
+            return false;
+
+        /* Scale and rotate about the first point: move it to the origin and back. */
+        bool around = pivot && (op.kind == OP_SCALE || op.kind == OP_ROTATE);
+        if (around)
+            c.ops.push_back(TransformOp::translation(-x0, -y0, -z0));
+        c.ops.push_back(op);
+        if (around)
+            c.ops.push_back(TransformOp::translation(x0, y0, z0));
+    }
+    return true;
+}
+
+void solveCase(TransformCase &c) {
+    double M[3][4];
+
+    c.T = getCompositeMatrix(c.ops);
+    c.T.rows(M);
+    transformBatch(M, c.points, c.result);
+}
+
+/* Like printf("%.4f") (and std::fixed with precision 4) */
+static inline char *fixed4(char *p, char *end, double v) {
+    return std::to_chars(p, end, v, std::chars_format::fixed, 4).ptr;
+}
+
+static void formatPoints(const PointArrays<double> &points, std::string &out) {
+    /* Up to 309 digits before the point for the largest doubles */
+    char line[3 * 320];
+
+    for (size_t i = 0; i < points.size(); i++) {
+        char *p = line, *end = line + sizeof(line);
+        p = fixed4(p, end, points.x[i]);
+        *p++ = ' ';
+        p = fixed4(p, end, points.y[i]);
+        *p++ = ' ';
+        p = fixed4(p, end, points.z[i]);
+        *p++ = '\n';
+        out.append(line, p - line);
+    }
+}
+
+/* Like arma::mat::print(): right-aligned cells of matrixCellWidth (affine.h), zeros as "0" */
+static void formatMatrix(const Mat4 &M, std::string &out) {
+    bool scientific;
+    int width = matrixCellWidth(M, &scientific);
+    std::chars_format format = scientific ? std::chars_format::scientific : std::chars_format::fixed;
+    char cell[64];
+
+    for (int r = 0; r < 4; r++) {
+        for (int c = 0; c < 4; c++) {
+            char *end = cell;
+            if (M(r, c) == 0)
+                *end++ = '0';
+            else
+                end = std::to_chars(cell, cell + sizeof(cell), M(r, c), format, 4).ptr;
+            int len = (int)(end - cell);
+            if (len < width)
+                out.append(width - len, ' ');
+            out.append(cell, len);
+        }
+        out.push_back('\n');
+    }
+}
+
+void formatCase(const TransformCase &c, std::string &out) {
+    formatPoints(c.points, out);
+    formatMatrix(c.T.toMat4(), out);
+    formatPoints(c.result, out);
+}
+
+CaseWriter::CaseWriter(FILE *out) : out(out) {
+    buf.reserve(WRITE_CHUNK + 4096);
+}
+
+CaseWriter::~CaseWriter() {
+    flush();
+}
+
+void CaseWriter::write(const TransformCase &c) {
+    formatCase(c, buf);
+    if (buf.size() >= WRITE_CHUNK)
+        flush();
+}
+
+void CaseWriter::flush() {
+    if (!buf.empty())
+        fwrite(buf.data(), 1, buf.size(), out);
+    buf.clear();
+    fflush(out);
+}
+
+size_t processBatch(FILE *in, FILE *out, TransformCase *last) {
+    CaseReader reader(in);
+    CaseWriter writer(out);
+    TransformCase c, next;
+    size_t cases = 0;
+
+    /* A case that fails to read is left half-filled, so read into next and keep c whole. */
+    while (reader.next(next)) {
+        std::swap(c, next);
+        solveCase(c);
+        writer.write(c);
+        cases++;
+    }
+    writer.flush();
+    if (last && cases > 0)
+        *last = c;
+    return cases;
+}
+
+/* Cases read together, and their output once solved. */
+struct CaseGroup {
+    std::vector<TransformCase> cases;
+    size_t count = 0;
+    std::string text;
+    bool done = false;
+};
+
+/*
+ * Group number g lives in slot g % slots.  The reader may only fill a slot
+ * once its previous group has been written, so read - written <= slots.
+ */
+struct Pipeline {
+    std::vector<CaseGroup> groups;
+    std::mutex lock;
+    std::condition_variable canRead, canSolve, canWrite;
+    size_t read = 0, taken = 0, written = 0;
+    bool inputDone = false;
+
+    CaseGroup &slot(size_t g) { return groups[g % groups.size()]; }
+};
+
+/*
+ * Reads up to GROUP_CASES cases or GROUP_POINTS points.  Returns false if
+ * the input ended (or a case was malformed) before the group was full.
+ */
+static bool readGroup(CaseReader &reader, CaseGroup &group) {
+    size_t points = 0;
+
+    group.count = 0;
+    while (group.count < GROUP_CASES && points < GROUP_POINTS) {
+        if (group.count == group.cases.size())
+            group.cases.emplace_back();
+        TransformCase &c = group.cases[group.count];
+        if (!reader.next(c))
+            return false;
+        points += c.points.size();
+        group.count++;
+    }
+    return true;
+}
+
+static void readCases(Pipeline &pipe, FILE *in) {
+    CaseReader reader(in);
+    bool more = true;
+
+    for (size_t g = 0; more; g++) {
+        {
+            std::unique_lock<std::mutex> l(pipe.lock);
+            pipe.canRead.wait(l, [&] { return g - pipe.written < pipe.groups.size(); });
+        }
+        /* The slot is free: nobody else touches it until it is counted in read. */
+        CaseGroup &group = pipe.slot(g);
+        more = readGroup(reader, group);
+        if (group.count == 0)
+            break;
+        std::lock_guard<std::mutex> l(pipe.lock);
+        pipe.read++;
+        pipe.canSolve.notify_one();
+    }
+    std::lock_guard<std::mutex> l(pipe.lock);
+    pipe.inputDone = true;
+    pipe.canSolve.notify_all();
+    pipe.canWrite.notify_one();
+}
+
+static void solveCases(Pipeline &pipe) {
+    for (;;) {
+        size_t g;
+        {
+            std::unique_lock<std::mutex> l(pipe.lock);
+            pipe.canSolve.wait(l, [&] { return pipe.taken < pipe.read || pipe.inputDone; });
+            if (pipe.taken == pipe.read)
+                return;
+            g = pipe.taken++;
+        }
+        CaseGroup &group = pipe.slot(g);
+        group.text.clear();
+        for (size_t i = 0; i < group.count; i++) {
+            solveCase(group.cases[i]);
+            formatCase(group.cases[i], group.text);
+        }
+        std::lock_guard<std::mutex> l(pipe.lock);
+        group.done = true;
+        pipe.canWrite.notify_one();
+    }
+}
+
+size_t processBatchParallel(FILE *in, FILE *out, unsigned threads, TransformCase *last) {
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    if (threads == 1)
+        return processBatch(in, out, last);
+
+    /* Enough groups for every worker to have one in hand and one waiting. */
+    Pipeline pipe;
+    pipe.groups.resize(2 * threads + 2);
+
+    std::thread reader(readCases, std::ref(pipe), in);
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < threads; i++)
+        workers.emplace_back(solveCases, std::ref(pipe));
+
+    /* The calling thread writes the groups in order. */
+    size_t cases = 0;
+    for (;;) {
+        CaseGroup *group;
+        {
+            std::unique_lock<std::mutex> l(pipe.lock);
+            pipe.canWrite.wait(l, [&] {
+                return (pipe.written < pipe.read && pipe.slot(pipe.written).done) ||
+                       (pipe.inputDone && pipe.written == pipe.read);
+            });
+            if (pipe.written == pipe.read)
+                break;
+            group = &pipe.slot(pipe.written);
+        }
+        fwrite(group->text.data(), 1, group->text.size(), out);
+        cases += group->count;
+        std::lock_guard<std::mutex> l(pipe.lock);
+        group->done = false;
+        pipe.written++;
+        pipe.canRead.notify_one();
+    }
+    fflush(out);
+
+    reader.join();
+    for (std::thread &t : workers)
+        t.join();
+    /* The reader stops before reusing the slot of the last group. */
+    if (last && cases > 0) {
+        CaseGroup &group = pipe.slot(pipe.read - 1);
+        *last = group.cases[group.count - 1];
+    }
+    return cases;
+}
+
+void generateCases(FILE *out, size_t cases, int points, int transforms, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> coord(-100, 100), factor(1, 30), angle(-12, 12);
+    std::string text;
+    char line[128];
+
+    for (size_t k = 0; k < cases; k++) {
+        text.append(line, snprintf(line, sizeof(line), "%d %d\n", points, transforms));
+        /* One draw per statement: the order of arguments is unspecified */
+        for (int i = 0; i < points; i++) {
+            int x = coord(rng), y = coord(rng), z = coord(rng);
+            text.append(line, snprintf(line, sizeof(line), "%.1f %.1f %.1f\n", x / 10.0, y / 10.0, z / 10.0));
+        }
+        for (int i = 0; i < transforms; i++) {
+            int kind = rng() % 3;
+            if (kind == 0) {
+                int x = coord(rng), y = coord(rng), z = coord(rng);
+                text.append(line, snprintf(line, sizeof(line), "t %d %d %d\n", x / 10, y / 10, z / 10));
+            } else if (kind == 1) {
+                int x = factor(rng), y = factor(rng), z = factor(rng);
+                text.append(line, snprintf(line, sizeof(line), "s %.1f %.1f %.1f\n", x / 10.0, y / 10.0, z / 10.0));
+            } else {
+                char axis = "xyz"[rng() % 3];
+                text.append(line, snprintf(line, sizeof(line), "r %c %d\n", axis, 15 * angle(rng)));
+            }
+        }
+        if (text.size() >= WRITE_CHUNK) {
+            fwrite(text.data(), 1, text.size(), out);
+            text.clear();
+        }
+    }
+    fwrite(text.data(), 1, text.size(), out);
+    fflush(out);
+}
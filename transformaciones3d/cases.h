@@ -0,0 +1,112 @@
+/*
+ * Streaming processing of test cases.
+ *
+ * The input is a sequence of cases in the format of test.in:
+ *
+ *     n t
+ *     n lines "x y z"
+ *     t lines "t x y z", "s x y z" or "r axis angle"
+ *
+ * and each case prints its points, the composite matrix (as
+ * arma::mat::print would) and the transformed points.  As in the original
+ * program, a scale or rotation is done about the first point of the case
+ * unless one of the points is the origin.
+ *
+ * CaseReader reads the input in large blocks and parses numbers in place
+ * (see ops.h); CaseWriter formats with std::to_chars into a buffer that is
+ * written in large blocks.  A TransformCase is reused from one case to the
+ * next, so memory stays bounded by the largest case whatever the number of
+ * cases.
+ */
+#ifndef CASES_H
+#define CASES_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "affine.h"
+#include "batch.h"
+#include "ops.h"
+
+/* Bytes read from the input at a time */
+#define READ_CHUNK (1 << 20)
+/* A number or a transformation must fit in this many bytes */
+#define READ_LOOKAHEAD 4096
+/* Output buffered before writing it */
+#define WRITE_CHUNK (1 << 20)
+/* processBatchParallel hands out cases in groups of at most this many cases... */
+#define GROUP_CASES 1024
+/* ...or this many points, whichever comes first */
+#define GROUP_POINTS (1 << 16)
+
+struct TransformCase {
+    PointArrays<double> points;
+    std::vector<TransformOp> ops;   /* including the moves to and from the pivot */
+    Affine3 T;
+    PointArrays<double> result;
+};
+
+class CaseReader {
+public:
+    explicit CaseReader(FILE *in);
+
+    /* Reads the next case into c; false at the end or on a malformed case. */
+    bool next(TransformCase &c);
+
+private:
+    void fill(size_t n);
+    void skipSpaces();
+    bool readInt(int &v);
+    bool readNumber(double &v);
+    bool readOp(TransformOp &op);
+
+    FILE *in;
+    std::vector<char> buf;
+    size_t begin, end;
+    bool eof;
+};
+
+/* Composite matrix and transformed points of a case that has been read. */
+void solveCase(TransformCase &c);
+
+/* Appends the output of a solved case to out. */
+void formatCase(const TransformCase &c, std::string &out);
+
+class CaseWriter {
+public:
+    explicit CaseWriter(FILE *out);
+    ~CaseWriter();
+
+    void write(const TransformCase &c);
+    void flush();
+
+private:
+    FILE *out;
+    std::string buf;
+};
+
+/*
+ * Reads, solves and writes every case of in.  If last is not NULL it keeps
+ * the last case.  Returns the number of cases.
+ */
+size_t processBatch(FILE *in, FILE *out, TransformCase *last);
+
+/*
+ * Same as processBatch, pipelined over 'threads' worker threads (0: one per
+ * core).  A reader thread splits the input into groups of cases, the
+ * workers solve and format whole groups, and the calling thread writes
+ * them in input order, so the output is byte for byte that of
+ * processBatch.  At most a few groups per worker are in flight, which
+ * bounds memory as in processBatch.  With 1 thread it is processBatch.
+ */
+size_t processBatchParallel(FILE *in, FILE *out, unsigned threads, TransformCase *last);
+
+/*
+ * Writes 'cases' random cases in the format of test.in, each with 'points'
+ * points and 'transforms' transformations.  The same seed gives the same
+ * cases.
+ */
+void generateCases(FILE *out, size_t cases, int points, int transforms, uint32_t seed);
+
+#endif
@@ -0,0 +1,23 @@
+/*
+ * Generates random test cases in the format of test.in.
+ *
+ * To build: make gencases
+ * To run:   ./gencases CASES [POINTS] [TRANSFORMS] [SEED] > cases.in
+ */
+#include <cstdio>
+#include <cstdlib>
+#include "cases.h"
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s CASES [POINTS] [TRANSFORMS] [SEED]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    size_t cases = strtoull(argv[1], NULL, 10);
+    int points = argc > 2 ? atoi(argv[2]) : 4;
+    int transforms = argc > 3 ? atoi(argv[3]) : 3;
+    uint32_t seed = argc > 4 ? (uint32_t)strtoul(argv[4], NULL, 10) : 1;
+
+    generateCases(stdout, cases, points, transforms, seed);
+    return EXIT_SUCCESS;
+}
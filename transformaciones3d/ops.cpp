@@ -0,0 +1,91 @@
+#include <charconv>
+#include "ops.h"
+
+static inline bool isSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+static inline void skipSpaces(const char **p, const char *end) {
+    while (*p < end && isSpace(**p))
+        (*p)++;
+}
+
+bool readNumber(const char **p, const char *end, double &v) {
+    skipSpaces(p, end);
+    if (*p < end && **p == '+')
+        (*p)++;
+    std::from_chars_result res = std::from_chars(*p, end, v);
+    if (res.ec != std::errc())
+        return false;
+    *p = res.ptr;
+    return true;
+}
+
+static inline bool readOpKind(char c, OpKind &kind) {
+    switch (c) {
+        case 't': kind = OP_TRANSLATE; return true;
+        case 's': kind = OP_SCALE;     return true;
+        case 'r': kind = OP_ROTATE;    return true;
+        default:  return false;
+    }
+}
+
+static inline Axis axisOf(char c) {
+    return c == 'x' ? AXIS_X : c == 'y' ? AXIS_Y : AXIS_Z;
+}
+
+bool readOp(const char **p, const char *end, TransformOp &op) {
+    skipSpaces(p, end);
+    if (*p >= end || !readOpKind(**p, op.kind))
+        return false;
+    (*p)++;
+
+    if (op.kind == OP_ROTATE) {
+        skipSpaces(p, end);
+        if (*p >= end)
+            return false;
+        op.axis = axisOf(*(*p)++);
+        op.p[1] = op.p[2] = 0;
+        return readNumber(p, end, op.p[0]);
+    }
+    op.axis = AXIS_X;
+    return readNumber(p, end, op.p[0]) && readNumber(p, end, op.p[1]) &&
+           readNumber(p, end, op.p[2]);
+}
+
+size_t readOps(const char *begin, const char *end, std::vector<TransformOp> &ops) {
+    size_t first = ops.size();
+    TransformOp op;
+
+    while (readOp(&begin, end, op))
+        ops.push_back(op);
+    return ops.size() - first;
+}
+
+/*
+ * Multiplies the matrices from left to right: T = B_(n-1) ... B_1 B_0, so
+ * each new factor goes on the right of the product of the later ones.
+ */
+Affine3 getCompositeMatrix(const TransformOp *ops, size_t n) {
+    Affine3 T = Affine3::identity();
+
+    for (size_t i = n; i-- > 0; ) {
+        const TransformOp &op = ops[i];
+        switch (op.kind) {
+            case OP_TRANSLATE:
+                T.translate(op.p[0], op.p[1], op.p[2]);
+                break;
+            case OP_SCALE:
+                T.scale(op.p[0], op.p[1], op.p[2]);
+                break;
+            case OP_ROTATE:
+                T.rotateDeg(op.axis, op.p[0]);
+                break;
+        }
+    }
+    return T;
+}
+
+Affine3 getCompositeMatrix(const std::vector<TransformOp> &ops) {
+    return getCompositeMatrix(ops.data(), ops.size());
+}
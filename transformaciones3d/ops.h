@@ -0,0 +1,52 @@
+/*
+ * Transformations as compact tagged values.
+ *
+ * A TransformOp is one line of a test case ("t 2 2 2", "s 1 1 2" or
+ * "r x 45") parsed into a fixed 32-byte record, so a list of them is a
+ * single contiguous array and composing it needs no string comparisons.
+ */
+#ifndef OPS_H
+#define OPS_H
+
+#include <cstddef>
+#include <vector>
+#include "affine.h"
+
+enum OpKind : unsigned char { OP_TRANSLATE, OP_SCALE, OP_ROTATE };
+
+struct TransformOp {
+    OpKind kind;
+    Axis axis;              /* only for OP_ROTATE */
+    double p[3];            /* x, y, z; the angle in degrees in p[0] for OP_ROTATE */
+
+    static TransformOp translation(double x, double y, double z) {
+        return TransformOp{OP_TRANSLATE, AXIS_X, {x, y, z}};
+    }
+};
+
+/*
+ * Reads a number from [*p, end) after any whitespace and an optional '+'
+ * (std::from_chars takes neither) and leaves *p after it.
+ */
+bool readNumber(const char **p, const char *end, double &v);
+
+/*
+ * Reads one transformation from [*p, end), skipping leading whitespace,
+ * and leaves *p after it.  Numbers are converted in place with
+ * std::from_chars.  The axis of a rotation is x, y or (anything else) z,
+ * as in getCompositeMatrix.  Returns false at the end of the input or on
+ * a malformed transformation.
+ */
+bool readOp(const char **p, const char *end, TransformOp &op);
+
+/* Reads transformations until the end of [begin, end) or the first malformed one. */
+size_t readOps(const char *begin, const char *end, std::vector<TransformOp> &ops);
+
+/*
+ * Composite matrix of the transformations, the first one applied first
+ * (see affine.h).
+ */
+Affine3 getCompositeMatrix(const TransformOp *ops, size_t n);
+Affine3 getCompositeMatrix(const std::vector<TransformOp> &ops);
+
+#endif